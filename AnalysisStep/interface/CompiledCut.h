@@ -0,0 +1,446 @@
+#ifndef CompiledCut_h
+#define CompiledCut_h
+
+/** \class CompiledCut
+ *
+ *  Drop-in replacement for StringCutObjectSelector<T, true>. The cut string is
+ *  compiled once into a small stack bytecode whose loads are C++ accessors
+ *  taken from CutAccessors<T>, so evaluating it does not go through
+ *  reflection; string arguments (userFloat labels, tauID names, dB types) are
+ *  bound at compile time.
+ *
+ *  The supported subset is: || && ! (also | and &), comparisons, + - * /,
+ *  unary minus, abs(), numbers, the accessors registered in CutAccessors<T>
+ *  and daughter(i).<reco::Candidate accessor>. Anything else falls back to
+ *  the StringCutObjectSelector, which is always built so that configuration
+ *  errors are reported as before. With validate=true both versions are
+ *  evaluated and a mismatch throws.
+ */
+
+#include <CommonTools/Utils/interface/StringCutObjectSelector.h>
+#include <DataFormats/Candidate/interface/Candidate.h>
+#include <FWCore/MessageLogger/interface/MessageLogger.h>
+#include <FWCore/Utilities/interface/Exception.h>
+
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace compiledcut {
+  // Detection of the optional interfaces used to fill CutAccessors<T>
+  template<class T, class=void> struct hasUserData : std::false_type {};
+  template<class T> struct hasUserData<T, std::void_t<decltype(std::declval<const T&>().userFloat(std::declval<const std::string&>()))> > : std::true_type {};
+
+  template<class T, class=void> struct hasTauID : std::false_type {};
+  template<class T> struct hasTauID<T, std::void_t<decltype(std::declval<const T&>().tauID(std::declval<const std::string&>()))> > : std::true_type {};
+
+  template<class T, class=void> struct hasMuonStations : std::false_type {};
+  template<class T> struct hasMuonStations<T, std::void_t<decltype(std::declval<const T&>().numberOfMatchedStations())> > : std::true_type {};
+
+  template<class T, class=void> struct hasIpType : std::false_type {};
+  template<class T> struct hasIpType<T, std::void_t<typename T::IpType> > : std::true_type {};
+}
+
+
+/// Registry of the C++ accessors available to CompiledCut<T>, by method name
+template<class T>
+class CutAccessors {
+public:
+  typedef std::function<double(const T&)> Accessor;
+  /// Accessor taking a string argument, bound when the cut is compiled
+  typedef std::function<Accessor(const std::string&)> Binder;
+
+  static const CutAccessors& instance() {
+    static const CutAccessors accessors;
+    return accessors;
+  }
+
+  /// Accessor without arguments (empty if unknown)
+  Accessor find(const std::string& name) const {
+    typename std::map<std::string, Accessor>::const_iterator i = plain_.find(name);
+    return (i == plain_.end() ? Accessor() : i->second);
+  }
+
+  /// Accessor with a string argument (empty if unknown)
+  Accessor find(const std::string& name, const std::string& arg) const {
+    typename std::map<std::string, Binder>::const_iterator i = binders_.find(name);
+    return (i == binders_.end() ? Accessor() : i->second(arg));
+  }
+
+private:
+  CutAccessors();
+
+  std::map<std::string, Accessor> plain_;
+  std::map<std::string, Binder> binders_;
+};
+
+
+template<class T>
+CutAccessors<T>::CutAccessors() {
+  using namespace compiledcut;
+
+  // reco::Candidate
+  plain_["pt"]       = [](const T& o) -> double { return o.pt(); };
+  plain_["eta"]      = [](const T& o) -> double { return o.eta(); };
+  plain_["phi"]      = [](const T& o) -> double { return o.phi(); };
+  plain_["mass"]     = [](const T& o) -> double { return o.mass(); };
+  plain_["p"]        = [](const T& o) -> double { return o.p(); };
+  plain_["energy"]   = [](const T& o) -> double { return o.energy(); };
+  plain_["et"]       = [](const T& o) -> double { return o.et(); };
+  plain_["px"]       = [](const T& o) -> double { return o.px(); };
+  plain_["py"]       = [](const T& o) -> double { return o.py(); };
+  plain_["pz"]       = [](const T& o) -> double { return o.pz(); };
+  plain_["charge"]   = [](const T& o) -> double { return o.charge(); };
+  plain_["pdgId"]    = [](const T& o) -> double { return o.pdgId(); };
+  plain_["numberOfDaughters"] = [](const T& o) -> double { return o.numberOfDaughters(); };
+  plain_["isElectron"]        = [](const T& o) -> double { return o.isElectron(); };
+  plain_["isMuon"]            = [](const T& o) -> double { return o.isMuon(); };
+  plain_["isGlobalMuon"]      = [](const T& o) -> double { return o.isGlobalMuon(); };
+  plain_["isTrackerMuon"]     = [](const T& o) -> double { return o.isTrackerMuon(); };
+  plain_["isStandAloneMuon"]  = [](const T& o) -> double { return o.isStandAloneMuon(); };
+
+  // pat::PATObject user data
+  if constexpr (hasUserData<T>::value) {
+    binders_["userFloat"]    = [](const std::string& key) -> Accessor { return [key](const T& o) -> double { return o.userFloat(key); }; };
+    binders_["userInt"]      = [](const std::string& key) -> Accessor { return [key](const T& o) -> double { return o.userInt(key); }; };
+    binders_["hasUserFloat"] = [](const std::string& key) -> Accessor { return [key](const T& o) -> double { return o.hasUserFloat(key); }; };
+    binders_["hasUserInt"]   = [](const std::string& key) -> Accessor { return [key](const T& o) -> double { return o.hasUserInt(key); }; };
+  }
+
+  // pat::Tau
+  if constexpr (hasTauID<T>::value) {
+    binders_["tauID"] = [](const std::string& id) -> Accessor { return [id](const T& o) -> double { return o.tauID(id); }; };
+    plain_["decayMode"] = [](const T& o) -> double { return o.decayMode(); };
+  }
+
+  // pat::Muon
+  if constexpr (hasMuonStations<T>::value) {
+    plain_["numberOfMatchedStations"] = [](const T& o) -> double { return o.numberOfMatchedStations(); };
+    plain_["numberOfMatches"]         = [](const T& o) -> double { return o.numberOfMatches(); };
+    plain_["isPFMuon"]                = [](const T& o) -> double { return o.isPFMuon(); };
+  }
+
+  // pat::Muon and pat::Electron impact parameters
+  if constexpr (hasIpType<T>::value) {
+    typedef typename T::IpType IpType;
+    static const std::map<std::string, IpType> ipTypes = {
+      {"PV2D", T::PV2D}, {"PV3D", T::PV3D}, {"BS2D", T::BS2D}, {"BS3D", T::BS3D}, {"PVDZ", T::PVDZ}
+    };
+    binders_["dB"] = [](const std::string& type) -> Accessor {
+      typename std::map<std::string, IpType>::const_iterator i = ipTypes.find(type);
+      if (i == ipTypes.end()) return Accessor();
+      IpType t = i->second;
+      return [t](const T& o) -> double { return o.dB(t); };
+    };
+    binders_["edB"] = [](const std::string& type) -> Accessor {
+      typename std::map<std::string, IpType>::const_iterator i = ipTypes.find(type);
+      if (i == ipTypes.end()) return Accessor();
+      IpType t = i->second;
+      return [t](const T& o) -> double { return o.edB(t); };
+    };
+  }
+}
+
+
+template<class T>
+class CompiledCut {
+public:
+  typedef typename CutAccessors<T>::Accessor Accessor;
+
+  /// Compile the cut; useString forces the StringCutObjectSelector
+  explicit CompiledCut(const std::string& cut, bool validate=false, bool useString=false)
+    : cut_(cut), selector_(cut), validate_(validate), compiled_(false)
+  {
+    if (!useString) {
+      Compiler compiler(cut_, code_, loads_);
+      compiled_ = compiler.run();
+      if (!compiled_) {
+        code_.clear();
+        loads_.clear();
+        edm::LogInfo("CompiledCut") << "Cut not compiled, using the string version: \"" << cut_ << "\"";
+      }
+    }
+  }
+
+  bool operator()(const T& o) const {
+    if (!compiled_) return selector_(o);
+    bool result = (eval(o) != 0);
+    if (validate_ && result != selector_(o)) {
+      throw cms::Exception("CompiledCut") << "Compiled and string versions of the cut \"" << cut_ << "\" disagree";
+    }
+    return result;
+  }
+
+  const std::string& cut() const { return cut_; }
+  bool isCompiled() const { return compiled_; }
+
+private:
+  enum OpCode { kConst, kLoad, kNeg, kNot, kBool, kAbs, kAdd, kSub, kMul, kDiv,
+                kLT, kLE, kGT, kGE, kEQ, kNE,
+                kAndJump,  // if top is false jump to arg, else pop it
+                kOrJump }; // if top is true set it to 1 and jump to arg, else pop it
+  struct Instr {
+    OpCode op;
+    unsigned arg;
+    double value;
+  };
+  static const unsigned maxDepth = 16;
+
+  /// Recursive descent over the cut string, emitting the bytecode; run() returns false on anything unsupported
+  class Compiler {
+  public:
+    Compiler(const std::string& s, std::vector<Instr>& code, std::vector<Accessor>& loads)
+      : s_(s), pos_(0), depth_(0), maxDepth_(0), code_(code), loads_(loads) {}
+
+    bool run() {
+      skip();
+      if (pos_ == s_.size()) { // empty cut: accept all, as StringCutObjectSelector
+        emit(kConst, 0, 1.);
+        return true;
+      }
+      if (!orExpr()) return false;
+      skip();
+      return pos_ == s_.size() && maxDepth_ <= int(maxDepth);
+    }
+
+  private:
+    void skip() { while (pos_ < s_.size() && std::isspace((unsigned char)s_[pos_])) ++pos_; }
+
+    bool accept(const char* tok) {
+      skip();
+      size_t n = std::char_traits<char>::length(tok);
+      if (s_.compare(pos_, n, tok) != 0) return false;
+      pos_ += n;
+      return true;
+    }
+
+    char peek() { skip(); return pos_ < s_.size() ? s_[pos_] : '\0'; }
+
+    void emit(OpCode op, unsigned arg=0, double value=0.) {
+      if (op == kConst || op == kLoad) ++depth_;
+      else if (op >= kAdd) --depth_; // binary operators and the fall-through of jumps
+      if (depth_ > maxDepth_) maxDepth_ = depth_;
+      code_.push_back(Instr{op, arg, value});
+    }
+
+    bool orExpr() {
+      if (!andExpr()) return false;
+      std::vector<size_t> jumps;
+      while (accept("||") || accept("|")) {
+        jumps.push_back(code_.size());
+        emit(kOrJump);
+        if (!andExpr()) return false;
+      }
+      if (!jumps.empty()) {
+        emit(kBool);
+        for (size_t j : jumps) code_[j].arg = code_.size();
+      }
+      return true;
+    }
+
+    bool andExpr() {
+      if (!notExpr()) return false;
+      std::vector<size_t> jumps;
+      while (accept("&&") || accept("&")) {
+        jumps.push_back(code_.size());
+        emit(kAndJump);
+        if (!notExpr()) return false;
+      }
+      if (!jumps.empty()) {
+        emit(kBool);
+        for (size_t j : jumps) code_[j].arg = code_.size();
+      }
+      return true;
+    }
+
+    bool notExpr() {
+      if (peek() == '!' && s_.compare(pos_, 2, "!=") != 0) {
+        ++pos_;
+        if (!notExpr()) return false;
+        emit(kNot);
+        return true;
+      }
+      return cmpExpr();
+    }
+
+    bool cmpExpr() {
+      if (!sumExpr()) return false;
+      OpCode op;
+      if      (accept("<=")) op = kLE;
+      else if (accept(">=")) op = kGE;
+      else if (accept("==")) op = kEQ;
+      else if (accept("!=")) op = kNE;
+      else if (accept("<"))  op = kLT;
+      else if (accept(">"))  op = kGT;
+      else return true;
+      if (!sumExpr()) return false;
+      emit(op);
+      return true;
+    }
+
+    bool sumExpr() {
+      if (!prodExpr()) return false;
+      while (true) {
+        OpCode op;
+        if      (accept("+")) op = kAdd;
+        else if (accept("-")) op = kSub;
+        else return true;
+        if (!prodExpr()) return false;
+        emit(op);
+      }
+    }
+
+    bool prodExpr() {
+      if (!unaryExpr()) return false;
+      while (true) {
+        OpCode op;
+        if      (accept("*")) op = kMul;
+        else if (accept("/")) op = kDiv;
+        else return true;
+        if (!unaryExpr()) return false;
+        emit(op);
+      }
+    }
+
+    bool unaryExpr() {
+      if (accept("-")) {
+        if (!unaryExpr()) return false;
+        emit(kNeg);
+        return true;
+      }
+      if (accept("+")) return unaryExpr();
+      return primary();
+    }
+
+    bool primary() {
+      char c = peek();
+      if (std::isdigit((unsigned char)c) || c == '.') {
+        const char* begin = s_.c_str() + pos_;
+        char* end;
+        double value = std::strtod(begin, &end);
+        if (end == begin) return false;
+        pos_ += end - begin;
+        emit(kConst, 0, value);
+        return true;
+      }
+      if (c == '(') {
+        ++pos_;
+        return orExpr() && accept(")");
+      }
+
+      std::string name;
+      if (!identifier(name)) return false;
+      if (name == "abs") {
+        if (!accept("(") || !orExpr() || !accept(")")) return false;
+        emit(kAbs);
+        return true;
+      }
+
+      Accessor acc;
+      if (accept("(")) {
+        c = peek();
+        if (c == ')') {
+          ++pos_;
+          acc = CutAccessors<T>::instance().find(name);
+        } else if (c == '\'' || c == '"') {
+          size_t close = s_.find(c, pos_+1);
+          if (close == std::string::npos) return false;
+          std::string arg = s_.substr(pos_+1, close-pos_-1);
+          pos_ = close+1;
+          if (!accept(")")) return false;
+          acc = CutAccessors<T>::instance().find(name, arg);
+        } else if (name == "daughter" && std::isdigit((unsigned char)c)) {
+          // daughter(i).method, evaluated on the reco::Candidate daughter
+          unsigned i = 0;
+          while (std::isdigit((unsigned char)peek())) i = 10*i + (s_[pos_++] - '0');
+          std::string method;
+          if (!accept(")") || !accept(".") || !identifier(method)) return false;
+          if (accept("(") && !accept(")")) return false;
+          typename CutAccessors<reco::Candidate>::Accessor dauAcc = CutAccessors<reco::Candidate>::instance().find(method);
+          if (!dauAcc) return false;
+          acc = [i, dauAcc](const T& o) -> double {
+            const reco::Candidate* d = o.daughter(i);
+            if (d == nullptr) throw cms::Exception("CompiledCut") << "Candidate has no daughter " << i;
+            return dauAcc(*d);
+          };
+        } else {
+          return false;
+        }
+      } else {
+        acc = CutAccessors<T>::instance().find(name);
+      }
+      if (!acc) return false;
+
+      emit(kLoad, loads_.size());
+      loads_.push_back(acc);
+      return true;
+    }
+
+    bool identifier(std::string& name) {
+      skip();
+      size_t begin = pos_;
+      if (pos_ < s_.size() && (std::isalpha((unsigned char)s_[pos_]) || s_[pos_] == '_')) {
+        while (pos_ < s_.size() && (std::isalnum((unsigned char)s_[pos_]) || s_[pos_] == '_')) ++pos_;
+      }
+      name = s_.substr(begin, pos_-begin);
+      return !name.empty();
+    }
+
+    const std::string& s_;
+    size_t pos_;
+    int depth_, maxDepth_;
+    std::vector<Instr>& code_;
+    std::vector<Accessor>& loads_;
+  };
+
+  double eval(const T& o) const {
+    double stack[maxDepth];
+    unsigned top = 0;
+    for (unsigned pc = 0; pc < code_.size(); ++pc) {
+      const Instr& in = code_[pc];
+      switch (in.op) {
+      case kConst: stack[top++] = in.value; break;
+      case kLoad:  stack[top++] = loads_[in.arg](o); break;
+      case kNeg:   stack[top-1] = -stack[top-1]; break;
+      case kNot:   stack[top-1] = (stack[top-1] == 0); break;
+      case kBool:  stack[top-1] = (stack[top-1] != 0); break;
+      case kAbs:   stack[top-1] = std::abs(stack[top-1]); break;
+      case kAdd:   --top; stack[top-1] += stack[top]; break;
+      case kSub:   --top; stack[top-1] -= stack[top]; break;
+      case kMul:   --top; stack[top-1] *= stack[top]; break;
+      case kDiv:   --top; stack[top-1] /= stack[top]; break;
+      case kLT:    --top; stack[top-1] = (stack[top-1] <  stack[top]); break;
+      case kLE:    --top; stack[top-1] = (stack[top-1] <= stack[top]); break;
+      case kGT:    --top; stack[top-1] = (stack[top-1] >  stack[top]); break;
+      case kGE:    --top; stack[top-1] = (stack[top-1] >= stack[top]); break;
+      case kEQ:    --top; stack[top-1] = (stack[top-1] == stack[top]); break;
+      case kNE:    --top; stack[top-1] = (stack[top-1] != stack[top]); break;
+      case kAndJump:
+        if (stack[top-1] == 0) { stack[top-1] = 0; pc = in.arg-1; }
+        else --top;
+        break;
+      case kOrJump:
+        if (stack[top-1] != 0) { stack[top-1] = 1; pc = in.arg-1; }
+        else --top;
+        break;
+      }
+    }
+    return stack[0];
+  }
+
+  std::string cut_;
+  StringCutObjectSelector<T, true> selector_;
+  bool validate_;
+  bool compiled_;
+  std::vector<Instr> code_;
+  std::vector<Accessor> loads_;
+};
+
+#endif
@@ -7,7 +7,7 @@ namespace edm { class EventSetup; }
 #include <vector>
 #include "FWCore/Framework/interface/ESHandle.h"
 #include "MagneticField/Engine/interface/MagneticField.h"
-#include <TMatrixDSym.h>
+#include "DataFormats/Math/interface/AlgebraicROOTObjects.h"
 
 /* Mutuated from 
    /UserCode/Mangano/WWAnalysis/AnalysisStep/src/CompositeCandMassResolution.cc
@@ -22,12 +22,13 @@ class CompositeCandMassResolution  {
         double getMassResolution(const reco::Candidate &c) const ;
         double getMassResolutionWithComponents(const reco::Candidate &c, std::vector<double> &errI) const;
     private:
-        void   fillP3Covariance(const reco::Candidate &c, TMatrixDSym &bigCov, int offset) const ;
-        void   fillP3Covariance(const reco::GsfElectron &c, TMatrixDSym &bigCov, int offset) const ;
-        void   fillP3Covariance(const reco::Muon &c, TMatrixDSym &bigCov, int offset) const ;
-        void   fillP3Covariance(const reco::PFCandidate &c, TMatrixDSym &bigCov, int offset) const ;
-        void   fillP3Covariance(const reco::Candidate &c, const reco::Track &t, TMatrixDSym &bigCov, int offset) const ;
-	void   fillP3Covariance(const reco::LeafCandidate &c, TMatrixDSym &bigCov, int offset) const ;
+        // covariance of the (px,py,pz) of a leaf
+        void   fillP3Covariance(const reco::Candidate &c, AlgebraicSymMatrix33 &cov) const ;
+        void   fillP3Covariance(const reco::GsfElectron &c, AlgebraicSymMatrix33 &cov) const ;
+        void   fillP3Covariance(const reco::Muon &c, AlgebraicSymMatrix33 &cov) const ;
+        void   fillP3Covariance(const reco::PFCandidate &c, AlgebraicSymMatrix33 &cov) const ;
+        void   fillP3Covariance(const reco::Candidate &c, const reco::Track &t, AlgebraicSymMatrix33 &cov) const ;
+	void   fillP3Covariance(const reco::LeafCandidate &c, AlgebraicSymMatrix33 &cov) const ;
 
         edm::ESHandle<MagneticField> magfield_;
 
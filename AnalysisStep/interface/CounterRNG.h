@@ -0,0 +1,48 @@
+#ifndef CounterRNG_h
+#define CounterRNG_h
+
+/** \class CounterRNG
+ *
+ *  Counter-based random numbers (Philox4x32-10, Salmon et al., SC'11).
+ *  Each draw is a pure function of a key and a counter, so there is no
+ *  generator state: seeding with (run, lumi, event, object index) gives
+ *  the same numbers regardless of thread, stream, processing order or
+ *  job splitting.
+ */
+
+#include <array>
+#include <cstdint>
+
+namespace CounterRNG {
+
+  typedef std::array<uint32_t,4> Counter;
+  typedef std::array<uint32_t,2> Key;
+
+  /// Philox4x32 with 10 rounds
+  inline Counter philox4x32(Counter ctr, Key key) {
+    const uint32_t M0 = 0xD2511F53, M1 = 0xCD9E8D57;
+    const uint32_t W0 = 0x9E3779B9, W1 = 0xBB67AE85;
+    for (int round=0; round<10; ++round) {
+      if (round>0) { key[0] += W0; key[1] += W1; }
+      uint64_t p0 = uint64_t(M0)*ctr[0];
+      uint64_t p1 = uint64_t(M1)*ctr[2];
+      ctr = {{uint32_t(p1>>32)^ctr[1]^key[0], uint32_t(p1),
+              uint32_t(p0>>32)^ctr[3]^key[1], uint32_t(p0)}};
+    }
+    return ctr;
+  }
+
+  /// Uniform in the open interval (0,1), from 53 random bits
+  inline double toUniform(uint32_t hi, uint32_t lo) {
+    uint64_t bits = ((uint64_t(hi)<<32) | lo) >> 11;
+    return (bits + 0.5) * (1./9007199254740992.); // 2^-53
+  }
+
+  /// Uniform number for object \p index of event (run, lumi, event);
+  /// \p stream distinguishes independent uses (e.g. different modules).
+  inline double uniform(uint32_t seed, uint32_t run, uint32_t lumi, uint64_t event, uint32_t index, uint32_t stream=0) {
+    Counter out = philox4x32({{uint32_t(event), uint32_t(event>>32), lumi, run}}, {{seed, (index<<8) | (stream&0xFF)}});
+    return toUniform(out[0], out[1]);
+  }
+}
+#endif
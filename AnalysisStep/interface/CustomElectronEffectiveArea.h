@@ -20,6 +20,8 @@
 #ifndef STANDALONE
 #endif
 
+#include "HTauTauHMuMu/AnalysisStep/interface/EffectiveAreaBins.h"
+
 using namespace std;
 
 class ElectronEffectiveArea{
@@ -65,664 +67,213 @@ class ElectronEffectiveArea{
       kEleEA25nsSpring15MC
     };
 
+    static constexpr unsigned int kNTargets = kEleEA25nsSpring15MC + 1;
+    static constexpr unsigned int kNTypes   = kEleNeutralHadronIsoDR0p4To0p5 + 1;
+
     static Double_t GetElectronEffectiveArea(ElectronEffectiveAreaType type, Double_t SCEta, 
                                              ElectronEffectiveAreaTarget EffectiveAreaTarget = kEleEAData2011) {
-      
-      Double_t EffectiveArea = 0;
-
-
-      if (EffectiveAreaTarget == kEleEANoCorr) {
-        return 0.0;
-      }
-     // 25 ns spring15 MC Effective Areas ( //https://indico.cern.ch/event/369239/contribution/4/attachments/1134761/1623262/talk_effective_areas_25ns.pdf)
-      else if (EffectiveAreaTarget == kEleEA25nsSpring15MC) {
-	if (type == kEleGammaAndNeutralHadronIso03) {
-	  if (fabs(SCEta) >= 0.0    && fabs(SCEta) < 1.     ) EffectiveArea = 0.1752;
-	  if (fabs(SCEta) >= 1.     && fabs(SCEta) < 1.479  ) EffectiveArea = 0.1862;
-	  if (fabs(SCEta) >= 1.479  && fabs(SCEta) < 2.0    ) EffectiveArea = 0.1411;
-	  if (fabs(SCEta) >= 2.0    && fabs(SCEta) < 2.2    ) EffectiveArea = 0.1534;
-	  if (fabs(SCEta) >= 2.2    && fabs(SCEta) < 2.3    ) EffectiveArea = 0.1903;
-	  if (fabs(SCEta) >= 2.3    && fabs(SCEta) < 2.4    ) EffectiveArea = 0.2243;
-	  if (fabs(SCEta) >= 2.4 )                            EffectiveArea = 0.2687;
-	}
-	//for 0.4 the EA are the 0.3 values multiplied for the scale factor (4/3)^2 as suggested by the POG 
-	if (type == kEleGammaAndNeutralHadronIso04) {
-	  if (fabs(SCEta) >= 0.0    && fabs(SCEta) < 1.     ) EffectiveArea = 0.3115;
-	  if (fabs(SCEta) >= 1.     && fabs(SCEta) < 1.479  ) EffectiveArea = 0.3310;
-	  if (fabs(SCEta) >= 1.479  && fabs(SCEta) < 2.0    ) EffectiveArea = 0.2508;
-	  if (fabs(SCEta) >= 2.0    && fabs(SCEta) < 2.2    ) EffectiveArea = 0.2727;
-	  if (fabs(SCEta) >= 2.2    && fabs(SCEta) < 2.3    ) EffectiveArea = 0.3383;
-	  if (fabs(SCEta) >= 2.3    && fabs(SCEta) < 2.4    ) EffectiveArea = 0.3988;
-	  if (fabs(SCEta) >= 2.4 )                            EffectiveArea = 0.4777;
-	}
-      }
-
-      // Phys14 MC Effective Areas (from Giovanni : https://indico.cern.ch/event/367861/contribution/2/material/slides/0.pdf)
-      else if (EffectiveAreaTarget == kEleEAPhys14MC) {
-	if (type == kEleGammaAndNeutralHadronIso03) {
-	  if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 0.8 ) EffectiveArea = 0.1013;
-	  if (fabs(SCEta) >= 0.8 && fabs(SCEta) < 1.3 ) EffectiveArea = 0.0988;
-	  if (fabs(SCEta) >= 1.3 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.0572;
-	  if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.0842;
-	  if (fabs(SCEta) >= 2.2) EffectiveArea = 0.1530;
-	}
-	if (type == kEleGammaAndNeutralHadronIso04) {
-	  if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 0.8 ) EffectiveArea = 0.1830;
-	  if (fabs(SCEta) >= 0.8 && fabs(SCEta) < 1.3 ) EffectiveArea = 0.1734;
-	  if (fabs(SCEta) >= 1.3 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.1077;
-	  if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.1565;
-	  if (fabs(SCEta) >= 2.2) EffectiveArea = 0.2680;
-	}
-      }
-
-      //CSA14  MC Effective Areas (experimental, from Simon)
-      else if (EffectiveAreaTarget == kEleEASpring14MC_PU20bx25) {
-	if (type == kEleGammaAndNeutralHadronIso04) {
-	  if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.193;
-	  if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.185;
-	  if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.097;
-	  if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.134;
-	  if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.146;
-	  if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.209;
-	  if (fabs(SCEta) >= 2.4) EffectiveArea = 0.282;
-	}
-      }
-  
-      //2012 Data Effective Areas
-      else if (EffectiveAreaTarget == kEleEAData2012) {
-
-        if (type == kEleGammaIso03) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.122;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.147;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.055;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.106;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.138;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.221;
-          if (fabs(SCEta) >= 2.4 ) EffectiveArea = 0.211;
-        }
-        if (type == kEleGammaIso04) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.176;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.206;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.094;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.172;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.244;
-          if (fabs(SCEta) >= 2.4 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.333;
-          if (fabs(SCEta) >= 2.4 ) EffectiveArea = 0.348;
-        }
-        if (type == kEleNeutralHadronIso03) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.013;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.021;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.013;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.010;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.024;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.020;
-          if (fabs(SCEta) >= 2.4 ) EffectiveArea = 0.019;
-        }
-        if (type == kEleNeutralHadronIso04) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.022;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.036;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.027;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.028;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.052;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.063;
-          if (fabs(SCEta) >= 2.4 ) EffectiveArea = 0.028;
-        }
-        if (type == kEleGammaAndNeutralHadronIso04) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.19;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.25;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.12;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.21;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.27;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.44;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.52;
-        }
-        if (type == kEleGammaIsoDR0p0To0p1) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.082;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.106;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.029;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.057;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.059;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.075;
-          if (fabs(SCEta) >= 2.4 ) EffectiveArea = 0.068;
-        }
-        if (type == kEleNeutralHadronIsoDR0p0To0p1) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.010;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.011;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.007;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.003;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.004;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.007;
-          if (fabs(SCEta) >= 2.4 ) EffectiveArea = 0.002;
-        }
-        if (type == kEleGammaIsoDR0p1To0p2) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.030;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.028;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.023;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.052;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.057;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.063;
-          if (fabs(SCEta) >= 2.4 ) EffectiveArea = 0.007;
-        }
-        if (type == kEleNeutralHadronIsoDR0p1To0p2) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.006;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.008;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.006;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.003;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.004;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.006;
-          if (fabs(SCEta) >= 2.4 ) EffectiveArea = 0.002;
-        }
-        if (type == kEleGammaIsoDR0p2To0p3) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.043;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.039;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.027;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.050;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.076;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.133;
-          if (fabs(SCEta) >= 2.4 ) EffectiveArea = 0.129;
-        }
-        if (type == kEleNeutralHadronIsoDR0p2To0p3) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.008;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.011;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.007;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.008;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.017;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.004;
-          if (fabs(SCEta) >= 2.4 ) EffectiveArea = 0.013;
-        }
-        if (type == kEleGammaIsoDR0p3To0p4) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.063;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.052;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.038;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.070;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.092;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.121;
-          if (fabs(SCEta) >= 2.4 ) EffectiveArea = 0.138;
-        }
-        if (type == kEleNeutralHadronIsoDR0p3To0p4) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.011;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.016;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.011;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.013;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.022;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.031;
-          if (fabs(SCEta) >= 2.4 ) EffectiveArea = 0.007;
-        }
-        if (type == kEleGammaIsoDR0p4To0p5) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.083;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.068;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.054;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.090;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.119;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.142;
-          if (fabs(SCEta) >= 2.4 ) EffectiveArea = 0.123;
-        }
-        if (type == kEleNeutralHadronIsoDR0p4To0p5) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.014;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.021;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.020;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.019;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.038;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.084;
-          if (fabs(SCEta) >= 2.4 ) EffectiveArea = 0.030;
-        }
-      }
+      if (unsigned(EffectiveAreaTarget) >= kNTargets || unsigned(type) >= kNTypes) return 0.0;
+      return kEffectiveAreas[EffectiveAreaTarget][type].get(fabs(SCEta));
+    }
 
+ private:
+    // Effective areas per target and type, in bins of |SCEta|: {nBins, {lower edges}, {areas}}
+    static constexpr EffectiveAreaBins kEffectiveAreas[kNTargets][kNTypes] = {
+      {}, // kEleEANoCorr
       //2011 Data Effective Areas
-      else if (EffectiveAreaTarget == kEleEAData2011) {
-
-        if (type == kEleGammaIso03) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.081;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.084;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.048;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.089;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.092;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.097;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.110;
-        }
-        if (type == kEleGammaIso04) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.140;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.130;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.079;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.130;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.150;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.160;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.180;
-        }
-        if (type == kEleNeutralHadronIso03) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.024;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.037;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.037;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.023;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.023;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.021;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.021;
-        }
-        if (type == kEleNeutralHadronIso04) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.044;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.065;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.068;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.057;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.058;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.061;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.110;
-        }
-        if (type == kEleGammaAndNeutralHadronIso03) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.100;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.120;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.085;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.110;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.120;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.120;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.130;
-        }
-        if (type == kEleGammaAndNeutralHadronIso04) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.180;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.200;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.150;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.190;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.210;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.220;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.290;
-        }
-        if (type == kEleGammaIsoDR0p0To0p1) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.017;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.033;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.005;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.007;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.004;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.000;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.000;
-        }
-        if (type == kEleGammaIsoDR0p1To0p2) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.010;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.010;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.019;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.042;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.041;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.035;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.041;
-        }
-        if (type == kEleGammaIsoDR0p2To0p3) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.020;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.017;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.014;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.029;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.039;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.042;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.048;
-        }
-        if (type == kEleGammaIsoDR0p3To0p4) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.036;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.029;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.020;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.029;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.042;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.047;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.054;
-        }
-        if (type == kEleGammaIsoDR0p4To0p5) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.051;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.038;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.028;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.036;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.047;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.057;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.059;
-        }
-        if (type == kEleNeutralHadronIsoDR0p0To0p1) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.001;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.002;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.002;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.000;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.000;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.000;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.000;
-        }
-        if (type == kEleNeutralHadronIsoDR0p1To0p2) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.005;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.008;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.008;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.006;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.003;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.001;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.003;
-        }
-        if (type == kEleNeutralHadronIsoDR0p2To0p3) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.010;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.014;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.017;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.016;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.016;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.016;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.019;
-        }
-        if (type == kEleNeutralHadronIsoDR0p3To0p4) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.015;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.021;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.025;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.030;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.036;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.038;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.084;
-        }
-        if (type == kEleNeutralHadronIsoDR0p4To0p5) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.020;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.027;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.035;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.045;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.051;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.107;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.228;
-        }
-      } 
-
+      { // kEleEAData2011
+        /* kEleTrkIso03                   */ {},
+        /* kEleEcalIso03                  */ {},
+        /* kEleHcalIso03                  */ {},
+        /* kEleTrkIso04                   */ {},
+        /* kEleEcalIso04                  */ {},
+        /* kEleHcalIso04                  */ {},
+        /* kEleChargedIso03               */ {},
+        /* kEleGammaIso03                 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.081, 0.084, 0.048, 0.089, 0.092, 0.097, 0.110}},
+        /* kEleNeutralHadronIso03         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.024, 0.037, 0.037, 0.023, 0.023, 0.021, 0.021}},
+        /* kEleGammaAndNeutralHadronIso03 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.100, 0.120, 0.085, 0.110, 0.120, 0.120, 0.130}},
+        /* kEleChargedIso04               */ {},
+        /* kEleGammaIso04                 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.140, 0.130, 0.079, 0.130, 0.150, 0.160, 0.180}},
+        /* kEleNeutralHadronIso04         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.044, 0.065, 0.068, 0.057, 0.058, 0.061, 0.110}},
+        /* kEleGammaAndNeutralHadronIso04 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.180, 0.200, 0.150, 0.190, 0.210, 0.220, 0.290}},
+        /* kEleGammaIsoDR0p0To0p1         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.017, 0.033, 0.005, 0.007, 0.004, 0.000, 0.000}},
+        /* kEleGammaIsoDR0p1To0p2         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.010, 0.010, 0.019, 0.042, 0.041, 0.035, 0.041}},
+        /* kEleGammaIsoDR0p2To0p3         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.020, 0.017, 0.014, 0.029, 0.039, 0.042, 0.048}},
+        /* kEleGammaIsoDR0p3To0p4         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.036, 0.029, 0.020, 0.029, 0.042, 0.047, 0.054}},
+        /* kEleGammaIsoDR0p4To0p5         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.051, 0.038, 0.028, 0.036, 0.047, 0.057, 0.059}},
+        /* kEleNeutralHadronIsoDR0p0To0p1 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.001, 0.002, 0.002, 0.000, 0.000, 0.000, 0.000}},
+        /* kEleNeutralHadronIsoDR0p1To0p2 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.005, 0.008, 0.008, 0.006, 0.003, 0.001, 0.003}},
+        /* kEleNeutralHadronIsoDR0p2To0p3 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.010, 0.014, 0.017, 0.016, 0.016, 0.016, 0.019}},
+        /* kEleNeutralHadronIsoDR0p3To0p4 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.015, 0.021, 0.025, 0.030, 0.036, 0.038, 0.084}},
+        /* kEleNeutralHadronIsoDR0p4To0p5 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.020, 0.027, 0.035, 0.045, 0.051, 0.107, 0.228}}
+      },
       //Summer11 MC Effective Areas
-      else if (EffectiveAreaTarget == kEleEASummer11MC) {
-        //************************************************************************
-        //The next 6 effective areas are taken from the Data measurement, because
+      { // kEleEASummer11MC
+        /* kEleTrkIso03                   */ {},
+        /* kEleEcalIso03                  */ {},
+        /* kEleHcalIso03                  */ {},
+        /* kEleTrkIso04                   */ {},
+        /* kEleEcalIso04                  */ {},
+        /* kEleHcalIso04                  */ {},
+        /* kEleChargedIso03               */ {},
+        //The Iso03 and Iso04 effective areas are taken from the Data measurement, because
         //the calculation from Summer11 was not done.
-        //************************************************************************
-        if (type == kEleGammaIso03) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.081;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.084;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.048;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.089;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.092;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.097;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.110;
-        }
-        if (type == kEleGammaIso04) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.140;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.130;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.079;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.130;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.150;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.160;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.180;
-        }
-        if (type == kEleNeutralHadronIso03) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.024;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.037;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.037;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.023;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.023;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.021;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.021;
-        }
-        if (type == kEleNeutralHadronIso04) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.044;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.065;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.068;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.057;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.058;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.061;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.110;
-        }
-        if (type == kEleGammaAndNeutralHadronIso03) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.100;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.120;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.085;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.110;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.120;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.120;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.130;
-        }
-        if (type == kEleGammaAndNeutralHadronIso04) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.180;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.200;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.150;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.190;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.210;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.220;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.290;
-        } 
-
-        //************************************************************************
-        //The following effective areas are from Summer11 MC
-        //************************************************************************
-        if (type == kEleGammaIsoDR0p0To0p1) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.015;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.030;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.004;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.010;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.014;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.024;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.023;
-        }
-        if (type == kEleGammaIsoDR0p1To0p2) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.012;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.010;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.009;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.037;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.046;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.055;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.046;
-        }
-        if (type == kEleGammaIsoDR0p2To0p3) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.021;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.018;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.013;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.026;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.038;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.045;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.059;
-        }
-        if (type == kEleGammaIsoDR0p3To0p4) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.036;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.030;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.017;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.036;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.058;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.073;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.083;
-        }
-        if (type == kEleGammaIsoDR0p4To0p5) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.053;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.037;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.032;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.048;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.062;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.085;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.118;
-        }
-        if (type == kEleNeutralHadronIsoDR0p0To0p1) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.000;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.000;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.000;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.000;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.000;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.000;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.000;
-        }
-        if (type == kEleNeutralHadronIsoDR0p1To0p2) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.004;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.007;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.009;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.004;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.003;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.000;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.004;
-        }
-        if (type == kEleNeutralHadronIsoDR0p2To0p3) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.008;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.013;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.016;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.013;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.014;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.016;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.021;
-        }
-        if (type == kEleNeutralHadronIsoDR0p3To0p4) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.012;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.017;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.020;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.024;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.040;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.036;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.086;
-        }
-        if (type == kEleNeutralHadronIsoDR0p4To0p5) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.016;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.026;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.030;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.038;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.051;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.105;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.169;
-        }
-      } 
-  
+        /* kEleGammaIso03                 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.081, 0.084, 0.048, 0.089, 0.092, 0.097, 0.110}},
+        /* kEleNeutralHadronIso03         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.024, 0.037, 0.037, 0.023, 0.023, 0.021, 0.021}},
+        /* kEleGammaAndNeutralHadronIso03 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.100, 0.120, 0.085, 0.110, 0.120, 0.120, 0.130}},
+        /* kEleChargedIso04               */ {},
+        /* kEleGammaIso04                 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.140, 0.130, 0.079, 0.130, 0.150, 0.160, 0.180}},
+        /* kEleNeutralHadronIso04         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.044, 0.065, 0.068, 0.057, 0.058, 0.061, 0.110}},
+        /* kEleGammaAndNeutralHadronIso04 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.180, 0.200, 0.150, 0.190, 0.210, 0.220, 0.290}},
+        //The DR-binned effective areas are from Summer11 MC
+        /* kEleGammaIsoDR0p0To0p1         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.015, 0.030, 0.004, 0.010, 0.014, 0.024, 0.023}},
+        /* kEleGammaIsoDR0p1To0p2         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.012, 0.010, 0.009, 0.037, 0.046, 0.055, 0.046}},
+        /* kEleGammaIsoDR0p2To0p3         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.021, 0.018, 0.013, 0.026, 0.038, 0.045, 0.059}},
+        /* kEleGammaIsoDR0p3To0p4         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.036, 0.030, 0.017, 0.036, 0.058, 0.073, 0.083}},
+        /* kEleGammaIsoDR0p4To0p5         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.053, 0.037, 0.032, 0.048, 0.062, 0.085, 0.118}},
+        /* kEleNeutralHadronIsoDR0p0To0p1 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.000, 0.000, 0.000, 0.000, 0.000, 0.000, 0.000}},
+        /* kEleNeutralHadronIsoDR0p1To0p2 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.004, 0.007, 0.009, 0.004, 0.003, 0.000, 0.004}},
+        /* kEleNeutralHadronIsoDR0p2To0p3 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.008, 0.013, 0.016, 0.013, 0.014, 0.016, 0.021}},
+        /* kEleNeutralHadronIsoDR0p3To0p4 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.012, 0.017, 0.020, 0.024, 0.040, 0.036, 0.086}},
+        /* kEleNeutralHadronIsoDR0p4To0p5 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.016, 0.026, 0.030, 0.038, 0.051, 0.105, 0.169}}
+      },
       //Fall11 MC Effective Areas
-      else if (EffectiveAreaTarget == kEleEAFall11MC) {
-        if (type == kEleGammaIso03) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.084;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.090;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.049;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.099;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.122;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.132;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.155;
-        }
-        if (type == kEleGammaIso04) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.140;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.140;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.084;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.150;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.200;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.220;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.260;
-        }
-        if (type == kEleNeutralHadronIso03) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.022;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.039;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.040;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.028;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.027;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.024;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.030;
-        }
-        if (type == kEleNeutralHadronIso04) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.041;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.068;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.075;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.068;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.072;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.077;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.140;
-        }
-        if (type == kEleGammaAndNeutralHadronIso03) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.110;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.130;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.089;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.130;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.150;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.160;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.190;
-        }
-        if (type == kEleGammaAndNeutralHadronIso04) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.180;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.210;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.160;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.220;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.270;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.300;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.410;
-        }
-        if (type == kEleGammaIsoDR0p0To0p1) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.014;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.020;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.004;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.012;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.016;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.021;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.012;
-        }
-        if (type == kEleGammaIsoDR0p1To0p2) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.012;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.011;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.015;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.042;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.055;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.068;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.067;
-        }
-        if (type == kEleGammaIsoDR0p2To0p3) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.024;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.020;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.017;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.038;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.051;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.066;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.080;
-        }
-        if (type == kEleGammaIsoDR0p3To0p4) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.040;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.032;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.021;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.047;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.066;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.083;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.123;
-        }
-        if (type == kEleGammaIsoDR0p4To0p5) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.059;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.041;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.037;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.057;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.095;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.123;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.133;
-        }
-        if (type == kEleNeutralHadronIsoDR0p0To0p1) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.002;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.003;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.000;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.000;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.000;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.000;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.000;
-        }
-        if (type == kEleNeutralHadronIsoDR0p1To0p2) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.006;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.008;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.010;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.006;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.005;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.002;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.007;
-        }
-        if (type == kEleNeutralHadronIsoDR0p2To0p3) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.009;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.014;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.018;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.016;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.017;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.020;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.021;
-        }
-        if (type == kEleNeutralHadronIsoDR0p3To0p4) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.013;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.019;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.027;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.035;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.037;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.043;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.110;
-        }
-        if (type == kEleNeutralHadronIsoDR0p4To0p5) {
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.017;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.027;
-          if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.036;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.045;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.057;
-          if (fabs(SCEta) >= 2.3 && fabs(SCEta) < 2.4 ) EffectiveArea = 0.123;
-          if (fabs(SCEta) >= 2.4) EffectiveArea = 0.220;
-        }
+      { // kEleEAFall11MC
+        /* kEleTrkIso03                   */ {},
+        /* kEleEcalIso03                  */ {},
+        /* kEleHcalIso03                  */ {},
+        /* kEleTrkIso04                   */ {},
+        /* kEleEcalIso04                  */ {},
+        /* kEleHcalIso04                  */ {},
+        /* kEleChargedIso03               */ {},
+        /* kEleGammaIso03                 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.084, 0.090, 0.049, 0.099, 0.122, 0.132, 0.155}},
+        /* kEleNeutralHadronIso03         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.022, 0.039, 0.040, 0.028, 0.027, 0.024, 0.030}},
+        /* kEleGammaAndNeutralHadronIso03 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.110, 0.130, 0.089, 0.130, 0.150, 0.160, 0.190}},
+        /* kEleChargedIso04               */ {},
+        /* kEleGammaIso04                 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.140, 0.140, 0.084, 0.150, 0.200, 0.220, 0.260}},
+        /* kEleNeutralHadronIso04         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.041, 0.068, 0.075, 0.068, 0.072, 0.077, 0.140}},
+        /* kEleGammaAndNeutralHadronIso04 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.180, 0.210, 0.160, 0.220, 0.270, 0.300, 0.410}},
+        /* kEleGammaIsoDR0p0To0p1         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.014, 0.020, 0.004, 0.012, 0.016, 0.021, 0.012}},
+        /* kEleGammaIsoDR0p1To0p2         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.012, 0.011, 0.015, 0.042, 0.055, 0.068, 0.067}},
+        /* kEleGammaIsoDR0p2To0p3         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.024, 0.020, 0.017, 0.038, 0.051, 0.066, 0.080}},
+        /* kEleGammaIsoDR0p3To0p4         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.040, 0.032, 0.021, 0.047, 0.066, 0.083, 0.123}},
+        /* kEleGammaIsoDR0p4To0p5         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.059, 0.041, 0.037, 0.057, 0.095, 0.123, 0.133}},
+        /* kEleNeutralHadronIsoDR0p0To0p1 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.002, 0.003, 0.000, 0.000, 0.000, 0.000, 0.000}},
+        /* kEleNeutralHadronIsoDR0p1To0p2 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.006, 0.008, 0.010, 0.006, 0.005, 0.002, 0.007}},
+        /* kEleNeutralHadronIsoDR0p2To0p3 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.009, 0.014, 0.018, 0.016, 0.017, 0.020, 0.021}},
+        /* kEleNeutralHadronIsoDR0p3To0p4 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.013, 0.019, 0.027, 0.035, 0.037, 0.043, 0.110}},
+        /* kEleNeutralHadronIsoDR0p4To0p5 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.017, 0.027, 0.036, 0.045, 0.057, 0.123, 0.220}}
+      },
+      //2012 Data Effective Areas
+      { // kEleEAData2012
+        /* kEleTrkIso03                   */ {},
+        /* kEleEcalIso03                  */ {},
+        /* kEleHcalIso03                  */ {},
+        /* kEleTrkIso04                   */ {},
+        /* kEleEcalIso04                  */ {},
+        /* kEleHcalIso04                  */ {},
+        /* kEleChargedIso03               */ {},
+        /* kEleGammaIso03                 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.122, 0.147, 0.055, 0.106, 0.138, 0.221, 0.211}},
+        /* kEleNeutralHadronIso03         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.013, 0.021, 0.013, 0.010, 0.024, 0.020, 0.019}},
+        /* kEleGammaAndNeutralHadronIso03 */ {},
+        /* kEleChargedIso04               */ {},
+        /* kEleGammaIso04                 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.176, 0.206, 0.094, 0., 0., 0., 0.348}},
+        /* kEleNeutralHadronIso04         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.022, 0.036, 0.027, 0.028, 0.052, 0.063, 0.028}},
+        /* kEleGammaAndNeutralHadronIso04 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.19, 0.25, 0.12, 0.21, 0.27, 0.44, 0.52}},
+        /* kEleGammaIsoDR0p0To0p1         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.082, 0.106, 0.029, 0.057, 0.059, 0.075, 0.068}},
+        /* kEleGammaIsoDR0p1To0p2         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.030, 0.028, 0.023, 0.052, 0.057, 0.063, 0.007}},
+        /* kEleGammaIsoDR0p2To0p3         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.043, 0.039, 0.027, 0.050, 0.076, 0.133, 0.129}},
+        /* kEleGammaIsoDR0p3To0p4         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.063, 0.052, 0.038, 0.070, 0.092, 0.121, 0.138}},
+        /* kEleGammaIsoDR0p4To0p5         */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.083, 0.068, 0.054, 0.090, 0.119, 0.142, 0.123}},
+        /* kEleNeutralHadronIsoDR0p0To0p1 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.010, 0.011, 0.007, 0.003, 0.004, 0.007, 0.002}},
+        /* kEleNeutralHadronIsoDR0p1To0p2 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.006, 0.008, 0.006, 0.003, 0.004, 0.006, 0.002}},
+        /* kEleNeutralHadronIsoDR0p2To0p3 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.008, 0.011, 0.007, 0.008, 0.017, 0.004, 0.013}},
+        /* kEleNeutralHadronIsoDR0p3To0p4 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.011, 0.016, 0.011, 0.013, 0.022, 0.031, 0.007}},
+        /* kEleNeutralHadronIsoDR0p4To0p5 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.014, 0.021, 0.020, 0.019, 0.038, 0.084, 0.030}}
+      },
+      //CSA14  MC Effective Areas (experimental, from Simon)
+      { // kEleEASpring14MC_PU20bx25
+        /* kEleTrkIso03                   */ {},
+        /* kEleEcalIso03                  */ {},
+        /* kEleHcalIso03                  */ {},
+        /* kEleTrkIso04                   */ {},
+        /* kEleEcalIso04                  */ {},
+        /* kEleHcalIso04                  */ {},
+        /* kEleChargedIso03               */ {},
+        /* kEleGammaIso03                 */ {},
+        /* kEleNeutralHadronIso03         */ {},
+        /* kEleGammaAndNeutralHadronIso03 */ {},
+        /* kEleChargedIso04               */ {},
+        /* kEleGammaIso04                 */ {},
+        /* kEleNeutralHadronIso04         */ {},
+        /* kEleGammaAndNeutralHadronIso04 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.193, 0.185, 0.097, 0.134, 0.146, 0.209, 0.282}},
+        /* kEleGammaIsoDR0p0To0p1         */ {},
+        /* kEleGammaIsoDR0p1To0p2         */ {},
+        /* kEleGammaIsoDR0p2To0p3         */ {},
+        /* kEleGammaIsoDR0p3To0p4         */ {},
+        /* kEleGammaIsoDR0p4To0p5         */ {},
+        /* kEleNeutralHadronIsoDR0p0To0p1 */ {},
+        /* kEleNeutralHadronIsoDR0p1To0p2 */ {},
+        /* kEleNeutralHadronIsoDR0p2To0p3 */ {},
+        /* kEleNeutralHadronIsoDR0p3To0p4 */ {},
+        /* kEleNeutralHadronIsoDR0p4To0p5 */ {}
+      },
+      // Phys14 MC Effective Areas (from Giovanni : https://indico.cern.ch/event/367861/contribution/2/material/slides/0.pdf)
+      { // kEleEAPhys14MC
+        /* kEleTrkIso03                   */ {},
+        /* kEleEcalIso03                  */ {},
+        /* kEleHcalIso03                  */ {},
+        /* kEleTrkIso04                   */ {},
+        /* kEleEcalIso04                  */ {},
+        /* kEleHcalIso04                  */ {},
+        /* kEleChargedIso03               */ {},
+        /* kEleGammaIso03                 */ {},
+        /* kEleNeutralHadronIso03         */ {},
+        /* kEleGammaAndNeutralHadronIso03 */ {5, {0.0, 0.8, 1.3, 2.0, 2.2}, {0.1013, 0.0988, 0.0572, 0.0842, 0.1530}},
+        /* kEleChargedIso04               */ {},
+        /* kEleGammaIso04                 */ {},
+        /* kEleNeutralHadronIso04         */ {},
+        /* kEleGammaAndNeutralHadronIso04 */ {5, {0.0, 0.8, 1.3, 2.0, 2.2}, {0.1830, 0.1734, 0.1077, 0.1565, 0.2680}},
+        /* kEleGammaIsoDR0p0To0p1         */ {},
+        /* kEleGammaIsoDR0p1To0p2         */ {},
+        /* kEleGammaIsoDR0p2To0p3         */ {},
+        /* kEleGammaIsoDR0p3To0p4         */ {},
+        /* kEleGammaIsoDR0p4To0p5         */ {},
+        /* kEleNeutralHadronIsoDR0p0To0p1 */ {},
+        /* kEleNeutralHadronIsoDR0p1To0p2 */ {},
+        /* kEleNeutralHadronIsoDR0p2To0p3 */ {},
+        /* kEleNeutralHadronIsoDR0p3To0p4 */ {},
+        /* kEleNeutralHadronIsoDR0p4To0p5 */ {}
+      },
+      // 25 ns spring15 MC Effective Areas ( //https://indico.cern.ch/event/369239/contribution/4/attachments/1134761/1623262/talk_effective_areas_25ns.pdf)
+      { // kEleEA25nsSpring15MC
+        /* kEleTrkIso03                   */ {},
+        /* kEleEcalIso03                  */ {},
+        /* kEleHcalIso03                  */ {},
+        /* kEleTrkIso04                   */ {},
+        /* kEleEcalIso04                  */ {},
+        /* kEleHcalIso04                  */ {},
+        /* kEleChargedIso03               */ {},
+        /* kEleGammaIso03                 */ {},
+        /* kEleNeutralHadronIso03         */ {},
+        /* kEleGammaAndNeutralHadronIso03 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.1752, 0.1862, 0.1411, 0.1534, 0.1903, 0.2243, 0.2687}},
+        /* kEleChargedIso04               */ {},
+        /* kEleGammaIso04                 */ {},
+        /* kEleNeutralHadronIso04         */ {},
+        //for 0.4 the EA are the 0.3 values multiplied for the scale factor (4/3)^2 as suggested by the POG
+        /* kEleGammaAndNeutralHadronIso04 */ {7, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3, 2.4}, {0.3115, 0.3310, 0.2508, 0.2727, 0.3383, 0.3988, 0.4777}},
+        /* kEleGammaIsoDR0p0To0p1         */ {},
+        /* kEleGammaIsoDR0p1To0p2         */ {},
+        /* kEleGammaIsoDR0p2To0p3         */ {},
+        /* kEleGammaIsoDR0p3To0p4         */ {},
+        /* kEleGammaIsoDR0p4To0p5         */ {},
+        /* kEleNeutralHadronIsoDR0p0To0p1 */ {},
+        /* kEleNeutralHadronIsoDR0p1To0p2 */ {},
+        /* kEleNeutralHadronIsoDR0p2To0p3 */ {},
+        /* kEleNeutralHadronIsoDR0p3To0p4 */ {},
+        /* kEleNeutralHadronIsoDR0p4To0p5 */ {}
       }
-      return EffectiveArea;  
-    }
-
+    };
 };
 
 #endif
@@ -20,6 +20,8 @@
 #ifndef STANDALONE
 #endif
 
+#include "HTauTauHMuMu/AnalysisStep/interface/EffectiveAreaBins.h"
+
 using namespace std;
 
 class MuonEffectiveArea{
@@ -71,410 +73,197 @@ class MuonEffectiveArea{
     kMuEAPhys14MC,
   };
 
-  static Double_t GetMuonEffectiveArea(MuonEffectiveAreaType type, Double_t SCEta, 
-				       MuonEffectiveAreaTarget EffectiveAreaTarget = kMuEAData2011) {
-    
-    Double_t EffectiveArea = 0;
-    
-    
-    if (EffectiveAreaTarget == kMuEANoCorr) {
-      return 0.0;
-    }
+  static constexpr unsigned int kNTargets = kMuEAPhys14MC + 1;
+  static constexpr unsigned int kNTypes   = kMuNeutralIso05 + 1;
 
-    // Phys14 MC Effective Areas (from Giovanni : https://indico.cern.ch/event/367861/contribution/2/material/slides/0.pdf)
-    else if (EffectiveAreaTarget == kMuEAPhys14MC) {
-      if (type == kMuGammaAndNeutralHadronIso03) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 0.8 ) EffectiveArea = 0.0913;
-	if (fabs(SCEta) >= 0.8 && fabs(SCEta) < 1.3 ) EffectiveArea = 0.0765;
-	if (fabs(SCEta) >= 1.3 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.0546;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.0728;
-	if (fabs(SCEta) >= 2.2) EffectiveArea = 0.1177;
-      }
-      if (type == kMuGammaAndNeutralHadronIso04) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 0.8 ) EffectiveArea = 0.1564;
-	if (fabs(SCEta) >= 0.8 && fabs(SCEta) < 1.3 ) EffectiveArea = 0.1325;
-	if (fabs(SCEta) >= 1.3 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.0913;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.1212;
-	if (fabs(SCEta) >= 2.2) EffectiveArea = 0.2085;
-      }
-    }
-    
-    //2012 Data Effective Areas
-    else if (EffectiveAreaTarget == kMuEAData2012) {
-      if (type == kMuGammaIso04){
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 )   EffectiveArea = 0.50419;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.30582;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.19765;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 )   EffectiveArea = 0.28723;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 )   EffectiveArea = 0.52529;
-	if (fabs(SCEta) >= 2.3 )                        EffectiveArea = 0.48818;
-      }
-      if (type == kMuNeutralHadronIso04){
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 )   EffectiveArea = 0.16580;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.25904;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.24695;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 )   EffectiveArea = 0.22021;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 )   EffectiveArea = 0.34045;
-	if (fabs(SCEta) >= 2.3 )                        EffectiveArea = 0.21592;
-      }
-      if (type == kMuGammaAndNeutralHadronIso04){
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 )   EffectiveArea = 0.674;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.565;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.442;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 )   EffectiveArea = 0.515;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 )   EffectiveArea = 0.821;
-	if (fabs(SCEta) >= 2.3 )                        EffectiveArea = 0.660;
-      }
-      if (type == kMuGammaAndNeutralHadronIso03){
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 )   EffectiveArea = 0.382;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.317;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.242;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 )   EffectiveArea = 0.326;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 )   EffectiveArea = 0.462;
-	if (fabs(SCEta) >= 2.3 )                        EffectiveArea = 0.372;
-      }
-      if (type == kMuGammaAndNeutralHadronIso04Tight){
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 )   EffectiveArea = 0.340;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.310;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.315;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 )   EffectiveArea = 0.415;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 )   EffectiveArea = 0.658;
-	if (fabs(SCEta) >= 2.3 )                        EffectiveArea = 0.405;
-      }
-      if (type == kMuGammaAndNeutralHadronIso03Tight){
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 )   EffectiveArea = 0.207;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.183;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.177;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 )   EffectiveArea = 0.271;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 )   EffectiveArea = 0.348;
-	if (fabs(SCEta) >= 2.3 )                        EffectiveArea = 0.246;
-      }
-    }
+  static Double_t GetMuonEffectiveArea(MuonEffectiveAreaType type, Double_t SCEta, 
+                                       MuonEffectiveAreaTarget EffectiveAreaTarget = kMuEAData2011) {
+    if (unsigned(EffectiveAreaTarget) >= kNTargets || unsigned(type) >= kNTypes) return 0.0;
+    return kEffectiveAreas[EffectiveAreaTarget][type].get(fabs(SCEta));
+  }
 
+ private:
+  // Effective areas per target and type, in bins of |SCEta|: {nBins, {lower edges}, {areas}}
+  static constexpr EffectiveAreaBins kEffectiveAreas[kNTargets][kNTypes] = {
+    {}, // kMuEANoCorr
     //2011 Data Effective Areas
-    else if (EffectiveAreaTarget == kMuEAData2011) {
-      
-      if (type == kMuGammaIsoDR0p0To0p1) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.004;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.002;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.002;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.000;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.000;
-	if (fabs(SCEta) >= 2.3 ) EffectiveArea = 0.005;
-      }
-      if (type == kMuGammaIsoDR0p1To0p2) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.011;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.008;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.005;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.008;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.008;
-	if (fabs(SCEta) >= 2.3 ) EffectiveArea = 0.011;
-      }
-      if (type == kMuGammaIsoDR0p2To0p3) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.023;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.016;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.010;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.014;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.017;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.021;
-      }
-      if (type == kMuGammaIsoDR0p3To0p4) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.036;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.026;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.017;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.023;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.028;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.032;
-      }
-      if (type == kMuGammaIsoDR0p4To0p5) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.051;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.037;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.028;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.033;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.042;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.052;
-      }
-      if (type == kMuNeutralHadronIsoDR0p0To0p1) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.002;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.001;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.001;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.001;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.005;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.007;
-      }
-      if (type == kMuNeutralHadronIsoDR0p1To0p2) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.005;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.008;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.009;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.009;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.010;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.014;
-      }
-      if (type == kMuNeutralHadronIsoDR0p2To0p3) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.010;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.015;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.017;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.017;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.019;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.024;
-      }
-      if (type == kMuNeutralHadronIsoDR0p3To0p4) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.015;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.021;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.024;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.032;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.038;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.038;
-      }
-      if (type == kMuNeutralHadronIsoDR0p4To0p5) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.020;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.026;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.033;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.045;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.051;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.114;
-      }
-      /// BEGIN FROM SLIDE 11 OF  https://indico.cern.ch/getFile.py/access?contribId=1&resId=0&materialId=slides&confId=188494
+    { // kMuEAData2011
+      /* kMuTrkIso03                        */ {},
+      /* kMuEcalIso03                       */ {},
+      /* kMuHcalIso03                       */ {},
+      /* kMuTrkIso05                        */ {},
+      /* kMuEcalIso05                       */ {},
+      /* kMuHcalIso05                       */ {},
+      /* kMuChargedIso03                    */ {},
+      /// Iso03 and Iso04 areas from slide 11 of https://indico.cern.ch/getFile.py/access?contribId=1&resId=0&materialId=slides&confId=188494
       /// NOTE: to be used with the rho from ALL pf candidates within |eta|<2.5
-      if (type == kMuGammaIso03){
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.049;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.5 ) EffectiveArea = 0.030;
-	if (fabs(SCEta) >= 1.5 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.022;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.034;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.041;
-	if (fabs(SCEta) >= 2.3 )                      EffectiveArea = 0.048;
-      }
-      if (type == kMuGammaIso04){
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.085;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.5 ) EffectiveArea = 0.052;
-	if (fabs(SCEta) >= 1.5 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.038;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.055;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.070;
-	if (fabs(SCEta) >= 2.3 )                      EffectiveArea = 0.081;
-      }
-      if (type == kMuNeutralHadronIso03){
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.027;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.5 ) EffectiveArea = 0.039;
-          if (fabs(SCEta) >= 1.5 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.044;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.047;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.055;
-          if (fabs(SCEta) >= 2.3 )                      EffectiveArea = 0.065;
-      }
-      if (type == kMuNeutralHadronIso04){
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.046;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.5 ) EffectiveArea = 0.067;
-          if (fabs(SCEta) >= 1.5 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.074;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.083;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.095;
-          if (fabs(SCEta) >= 2.3 )                      EffectiveArea = 0.105;
-      }
-      if (type == kMuGammaAndNeutralHadronIso03){
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.076;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.5 ) EffectiveArea = 0.070;
-          if (fabs(SCEta) >= 1.5 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.067;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.082;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.097;
-          if (fabs(SCEta) >= 2.3 )                      EffectiveArea = 0.115;
-      }
-      if (type == kMuGammaAndNeutralHadronIso04){
-          if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.132;
-          if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.5 ) EffectiveArea = 0.120;
-          if (fabs(SCEta) >= 1.5 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.114;
-          if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.139;
-          if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.168;
-          if (fabs(SCEta) >= 2.3 )                      EffectiveArea = 0.189;
-      }
-      /// END FROM SLIDE 11 OF  https://indico.cern.ch/getFile.py/access?contribId=1&resId=0&materialId=slides&confId=188494
-
-      if (type == kMuGammaIso05){
- 	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.05317;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.03502;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.03689;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.05221;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.06668;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.0744;
-      }
-      if (type == kMuNeutralIso05) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.06408;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.07557;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.08864;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.11492;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.13784;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.18745;
-      }
-    } 
-    
+      /* kMuGammaIso03                      */ {6, {0.0, 1.0, 1.5, 2.0, 2.2, 2.3}, {0.049, 0.030, 0.022, 0.034, 0.041, 0.048}},
+      /* kMuNeutralHadronIso03              */ {6, {0.0, 1.0, 1.5, 2.0, 2.2, 2.3}, {0.027, 0.039, 0.044, 0.047, 0.055, 0.065}},
+      /* kMuGammaAndNeutralHadronIso03      */ {6, {0.0, 1.0, 1.5, 2.0, 2.2, 2.3}, {0.076, 0.070, 0.067, 0.082, 0.097, 0.115}},
+      /* kMuGammaIso03Tight                 */ {},
+      /* kMuNeutralHadronIso03Tight         */ {},
+      /* kMuGammaAndNeutralHadronIso03Tight */ {},
+      /* kMuChargedIso04                    */ {},
+      /* kMuGammaIso04                      */ {6, {0.0, 1.0, 1.5, 2.0, 2.2, 2.3}, {0.085, 0.052, 0.038, 0.055, 0.070, 0.081}},
+      /* kMuNeutralHadronIso04              */ {6, {0.0, 1.0, 1.5, 2.0, 2.2, 2.3}, {0.046, 0.067, 0.074, 0.083, 0.095, 0.105}},
+      /* kMuGammaAndNeutralHadronIso04      */ {6, {0.0, 1.0, 1.5, 2.0, 2.2, 2.3}, {0.132, 0.120, 0.114, 0.139, 0.168, 0.189}},
+      /* kMuGammaIso04Tight                 */ {},
+      /* kMuNeutralHadronIso04Tight         */ {},
+      /* kMuGammaAndNeutralHadronIso04Tight */ {},
+      /* kMuGammaIsoDR0p0To0p1              */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.004, 0.002, 0.002, 0.000, 0.000, 0.005}},
+      /* kMuGammaIsoDR0p1To0p2              */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.011, 0.008, 0.005, 0.008, 0.008, 0.011}},
+      /* kMuGammaIsoDR0p2To0p3              */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.023, 0.016, 0.010, 0.014, 0.017, 0.021}},
+      /* kMuGammaIsoDR0p3To0p4              */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.036, 0.026, 0.017, 0.023, 0.028, 0.032}},
+      /* kMuGammaIsoDR0p4To0p5              */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.051, 0.037, 0.028, 0.033, 0.042, 0.052}},
+      /* kMuNeutralHadronIsoDR0p0To0p1      */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.002, 0.001, 0.001, 0.001, 0.005, 0.007}},
+      /* kMuNeutralHadronIsoDR0p1To0p2      */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.005, 0.008, 0.009, 0.009, 0.010, 0.014}},
+      /* kMuNeutralHadronIsoDR0p2To0p3      */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.010, 0.015, 0.017, 0.017, 0.019, 0.024}},
+      /* kMuNeutralHadronIsoDR0p3To0p4      */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.015, 0.021, 0.024, 0.032, 0.038, 0.038}},
+      /* kMuNeutralHadronIsoDR0p4To0p5      */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.020, 0.026, 0.033, 0.045, 0.051, 0.114}},
+      /* kMuGammaIso05                      */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.05317, 0.03502, 0.03689, 0.05221, 0.06668, 0.0744}},
+      /* kMuNeutralIso05                    */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.06408, 0.07557, 0.08864, 0.11492, 0.13784, 0.18745}}
+    },
     //Summer11 MC Effective Areas
-    else if (EffectiveAreaTarget == kMuEASummer11MC) {
-      if (type == kMuGammaIsoDR0p0To0p1) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.000;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.000;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.000;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.000;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.000;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.006;
-      }
-      if (type == kMuGammaIsoDR0p1To0p2) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.012;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.007;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.006;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.008;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.019;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.015;
-      }
-      if (type == kMuGammaIsoDR0p2To0p3) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.023;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.018;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.013;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.016;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.024;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.036;
-      }
-      if (type == kMuGammaIsoDR0p3To0p4) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.038;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.027;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.019;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.033;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.041;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.062;
-      }
-      if (type == kMuGammaIsoDR0p4To0p5) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.055;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.038;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.032;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.052;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.066;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.093;
-      }
-      if (type == kMuNeutralHadronIsoDR0p0To0p1) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.002;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.005;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.000;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.000;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.000;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.003;
-      }
-      if (type == kMuNeutralHadronIsoDR0p1To0p2) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.005;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.006;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.009;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.008;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.009;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.013;
-      }
-      if (type == kMuNeutralHadronIsoDR0p2To0p3) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.009;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.013;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.015;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.016;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.020;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.024;
-      }
-      if (type == kMuNeutralHadronIsoDR0p3To0p4) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.012;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.019;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.021;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.025;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.030;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.044;
-      }
-      if (type == kMuNeutralHadronIsoDR0p4To0p5) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.016;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.026;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.030;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.038;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.048;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.118;
-      }
-    } 
-  
+    { // kMuEASummer11MC
+      /* kMuTrkIso03                        */ {},
+      /* kMuEcalIso03                       */ {},
+      /* kMuHcalIso03                       */ {},
+      /* kMuTrkIso05                        */ {},
+      /* kMuEcalIso05                       */ {},
+      /* kMuHcalIso05                       */ {},
+      /* kMuChargedIso03                    */ {},
+      /* kMuGammaIso03                      */ {},
+      /* kMuNeutralHadronIso03              */ {},
+      /* kMuGammaAndNeutralHadronIso03      */ {},
+      /* kMuGammaIso03Tight                 */ {},
+      /* kMuNeutralHadronIso03Tight         */ {},
+      /* kMuGammaAndNeutralHadronIso03Tight */ {},
+      /* kMuChargedIso04                    */ {},
+      /* kMuGammaIso04                      */ {},
+      /* kMuNeutralHadronIso04              */ {},
+      /* kMuGammaAndNeutralHadronIso04      */ {},
+      /* kMuGammaIso04Tight                 */ {},
+      /* kMuNeutralHadronIso04Tight         */ {},
+      /* kMuGammaAndNeutralHadronIso04Tight */ {},
+      /* kMuGammaIsoDR0p0To0p1              */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.000, 0.000, 0.000, 0.000, 0.000, 0.006}},
+      /* kMuGammaIsoDR0p1To0p2              */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.012, 0.007, 0.006, 0.008, 0.019, 0.015}},
+      /* kMuGammaIsoDR0p2To0p3              */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.023, 0.018, 0.013, 0.016, 0.024, 0.036}},
+      /* kMuGammaIsoDR0p3To0p4              */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.038, 0.027, 0.019, 0.033, 0.041, 0.062}},
+      /* kMuGammaIsoDR0p4To0p5              */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.055, 0.038, 0.032, 0.052, 0.066, 0.093}},
+      /* kMuNeutralHadronIsoDR0p0To0p1      */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.002, 0.005, 0.000, 0.000, 0.000, 0.003}},
+      /* kMuNeutralHadronIsoDR0p1To0p2      */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.005, 0.006, 0.009, 0.008, 0.009, 0.013}},
+      /* kMuNeutralHadronIsoDR0p2To0p3      */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.009, 0.013, 0.015, 0.016, 0.020, 0.024}},
+      /* kMuNeutralHadronIsoDR0p3To0p4      */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.012, 0.019, 0.021, 0.025, 0.030, 0.044}},
+      /* kMuNeutralHadronIsoDR0p4To0p5      */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.016, 0.026, 0.030, 0.038, 0.048, 0.118}},
+      /* kMuGammaIso05                      */ {},
+      /* kMuNeutralIso05                    */ {}
+    },
     //Fall11 MC Effective Areas
-    else if (EffectiveAreaTarget == kMuEAFall11MC) {
-      if (type == kMuGammaIsoDR0p0To0p1) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.004;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.002;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.003;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.009;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.003;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.011;
-      }
-      if (type == kMuGammaIsoDR0p1To0p2) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.012;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.008;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.006;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.012;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.019;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.024;
-      }
-      if (type == kMuGammaIsoDR0p2To0p3) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.026;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.020;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.012;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.022;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.027;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.034;
-      }
-      if (type == kMuGammaIsoDR0p3To0p4) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.042;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.033;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.022;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.036;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.059;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.068;
-      }
-      if (type == kMuGammaIsoDR0p4To0p5) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.060;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.043;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.036;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.055;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.092;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.115;
-      }
-      if (type == kMuNeutralHadronIsoDR0p0To0p1) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.002;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.004;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.004;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.004;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.010;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.014;
-      }
-      if (type == kMuNeutralHadronIsoDR0p1To0p2) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 )   EffectiveArea = 0.005;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.007;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.009;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 )   EffectiveArea = 0.009;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 )   EffectiveArea = 0.015;
-	if (fabs(SCEta) >= 2.3  )                       EffectiveArea = 0.017;
-      }
-      if (type == kMuNeutralHadronIsoDR0p2To0p3) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.009;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.015;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.016;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.018;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.022;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.026;
-      }
-      if (type == kMuNeutralHadronIsoDR0p3To0p4) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.013;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.021;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.026;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.032;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.037;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.042;
-      }
-      if (type == kMuNeutralHadronIsoDR0p4To0p5) {
-	if (fabs(SCEta) >= 0.0 && fabs(SCEta) < 1.0 ) EffectiveArea = 0.017;
-	if (fabs(SCEta) >= 1.0 && fabs(SCEta) < 1.479 ) EffectiveArea = 0.026;
-	if (fabs(SCEta) >= 1.479 && fabs(SCEta) < 2.0 ) EffectiveArea = 0.035;
-	if (fabs(SCEta) >= 2.0 && fabs(SCEta) < 2.2 ) EffectiveArea = 0.046;
-	if (fabs(SCEta) >= 2.2 && fabs(SCEta) < 2.3 ) EffectiveArea = 0.063;
-	if (fabs(SCEta) >= 2.3  ) EffectiveArea = 0.135;
-      }
+    { // kMuEAFall11MC
+      /* kMuTrkIso03                        */ {},
+      /* kMuEcalIso03                       */ {},
+      /* kMuHcalIso03                       */ {},
+      /* kMuTrkIso05                        */ {},
+      /* kMuEcalIso05                       */ {},
+      /* kMuHcalIso05                       */ {},
+      /* kMuChargedIso03                    */ {},
+      /* kMuGammaIso03                      */ {},
+      /* kMuNeutralHadronIso03              */ {},
+      /* kMuGammaAndNeutralHadronIso03      */ {},
+      /* kMuGammaIso03Tight                 */ {},
+      /* kMuNeutralHadronIso03Tight         */ {},
+      /* kMuGammaAndNeutralHadronIso03Tight */ {},
+      /* kMuChargedIso04                    */ {},
+      /* kMuGammaIso04                      */ {},
+      /* kMuNeutralHadronIso04              */ {},
+      /* kMuGammaAndNeutralHadronIso04      */ {},
+      /* kMuGammaIso04Tight                 */ {},
+      /* kMuNeutralHadronIso04Tight         */ {},
+      /* kMuGammaAndNeutralHadronIso04Tight */ {},
+      /* kMuGammaIsoDR0p0To0p1              */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.004, 0.002, 0.003, 0.009, 0.003, 0.011}},
+      /* kMuGammaIsoDR0p1To0p2              */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.012, 0.008, 0.006, 0.012, 0.019, 0.024}},
+      /* kMuGammaIsoDR0p2To0p3              */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.026, 0.020, 0.012, 0.022, 0.027, 0.034}},
+      /* kMuGammaIsoDR0p3To0p4              */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.042, 0.033, 0.022, 0.036, 0.059, 0.068}},
+      /* kMuGammaIsoDR0p4To0p5              */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.060, 0.043, 0.036, 0.055, 0.092, 0.115}},
+      /* kMuNeutralHadronIsoDR0p0To0p1      */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.002, 0.004, 0.004, 0.004, 0.010, 0.014}},
+      /* kMuNeutralHadronIsoDR0p1To0p2      */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.005, 0.007, 0.009, 0.009, 0.015, 0.017}},
+      /* kMuNeutralHadronIsoDR0p2To0p3      */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.009, 0.015, 0.016, 0.018, 0.022, 0.026}},
+      /* kMuNeutralHadronIsoDR0p3To0p4      */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.013, 0.021, 0.026, 0.032, 0.037, 0.042}},
+      /* kMuNeutralHadronIsoDR0p4To0p5      */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.017, 0.026, 0.035, 0.046, 0.063, 0.135}},
+      /* kMuGammaIso05                      */ {},
+      /* kMuNeutralIso05                    */ {}
+    },
+    //2012 Data Effective Areas
+    { // kMuEAData2012
+      /* kMuTrkIso03                        */ {},
+      /* kMuEcalIso03                       */ {},
+      /* kMuHcalIso03                       */ {},
+      /* kMuTrkIso05                        */ {},
+      /* kMuEcalIso05                       */ {},
+      /* kMuHcalIso05                       */ {},
+      /* kMuChargedIso03                    */ {},
+      /* kMuGammaIso03                      */ {},
+      /* kMuNeutralHadronIso03              */ {},
+      /* kMuGammaAndNeutralHadronIso03      */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.382, 0.317, 0.242, 0.326, 0.462, 0.372}},
+      /* kMuGammaIso03Tight                 */ {},
+      /* kMuNeutralHadronIso03Tight         */ {},
+      /* kMuGammaAndNeutralHadronIso03Tight */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.207, 0.183, 0.177, 0.271, 0.348, 0.246}},
+      /* kMuChargedIso04                    */ {},
+      /* kMuGammaIso04                      */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.50419, 0.30582, 0.19765, 0.28723, 0.52529, 0.48818}},
+      /* kMuNeutralHadronIso04              */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.16580, 0.25904, 0.24695, 0.22021, 0.34045, 0.21592}},
+      /* kMuGammaAndNeutralHadronIso04      */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.674, 0.565, 0.442, 0.515, 0.821, 0.660}},
+      /* kMuGammaIso04Tight                 */ {},
+      /* kMuNeutralHadronIso04Tight         */ {},
+      /* kMuGammaAndNeutralHadronIso04Tight */ {6, {0.0, 1.0, 1.479, 2.0, 2.2, 2.3}, {0.340, 0.310, 0.315, 0.415, 0.658, 0.405}},
+      /* kMuGammaIsoDR0p0To0p1              */ {},
+      /* kMuGammaIsoDR0p1To0p2              */ {},
+      /* kMuGammaIsoDR0p2To0p3              */ {},
+      /* kMuGammaIsoDR0p3To0p4              */ {},
+      /* kMuGammaIsoDR0p4To0p5              */ {},
+      /* kMuNeutralHadronIsoDR0p0To0p1      */ {},
+      /* kMuNeutralHadronIsoDR0p1To0p2      */ {},
+      /* kMuNeutralHadronIsoDR0p2To0p3      */ {},
+      /* kMuNeutralHadronIsoDR0p3To0p4      */ {},
+      /* kMuNeutralHadronIsoDR0p4To0p5      */ {},
+      /* kMuGammaIso05                      */ {},
+      /* kMuNeutralIso05                    */ {}
+    },
+    // Phys14 MC Effective Areas (from Giovanni : https://indico.cern.ch/event/367861/contribution/2/material/slides/0.pdf)
+    { // kMuEAPhys14MC
+      /* kMuTrkIso03                        */ {},
+      /* kMuEcalIso03                       */ {},
+      /* kMuHcalIso03                       */ {},
+      /* kMuTrkIso05                        */ {},
+      /* kMuEcalIso05                       */ {},
+      /* kMuHcalIso05                       */ {},
+      /* kMuChargedIso03                    */ {},
+      /* kMuGammaIso03                      */ {},
+      /* kMuNeutralHadronIso03              */ {},
+      /* kMuGammaAndNeutralHadronIso03      */ {5, {0.0, 0.8, 1.3, 2.0, 2.2}, {0.0913, 0.0765, 0.0546, 0.0728, 0.1177}},
+      /* kMuGammaIso03Tight                 */ {},
+      /* kMuNeutralHadronIso03Tight         */ {},
+      /* kMuGammaAndNeutralHadronIso03Tight */ {},
+      /* kMuChargedIso04                    */ {},
+      /* kMuGammaIso04                      */ {},
+      /* kMuNeutralHadronIso04              */ {},
+      /* kMuGammaAndNeutralHadronIso04      */ {5, {0.0, 0.8, 1.3, 2.0, 2.2}, {0.1564, 0.1325, 0.0913, 0.1212, 0.2085}},
+      /* kMuGammaIso04Tight                 */ {},
+      /* kMuNeutralHadronIso04Tight         */ {},
+      /* kMuGammaAndNeutralHadronIso04Tight */ {},
+      /* kMuGammaIsoDR0p0To0p1              */ {},
+      /* kMuGammaIsoDR0p1To0p2              */ {},
+      /* kMuGammaIsoDR0p2To0p3              */ {},
+      /* kMuGammaIsoDR0p3To0p4              */ {},
+      /* kMuGammaIsoDR0p4To0p5              */ {},
+      /* kMuNeutralHadronIsoDR0p0To0p1      */ {},
+      /* kMuNeutralHadronIsoDR0p1To0p2      */ {},
+      /* kMuNeutralHadronIsoDR0p2To0p3      */ {},
+      /* kMuNeutralHadronIsoDR0p3To0p4      */ {},
+      /* kMuNeutralHadronIsoDR0p4To0p5      */ {},
+      /* kMuGammaIso05                      */ {},
+      /* kMuNeutralIso05                    */ {}
     }
-
-    
-    return EffectiveArea;  
-  }
+  };
 };
 
 #endif
@@ -3,29 +3,36 @@
 
 /** \class CutSet
  *
- *  Convert a ParameterSet containing cut strings into a map<name, StringCutObjectSelector> for 
+ *  Convert a ParameterSet containing cut strings into a map<name, CompiledCut> for 
  *  the specified object type.
- *  
+ *  Cuts are compiled (see CompiledCut.h) unless their name is listed in the untracked
+ *  vstring "stringCuts" of the ParameterSet; the untracked bool "validateCompiledCuts"
+ *  evaluates the string version as well and throws if the two disagree.
  *
  *  $Date: 2012/05/02 22:17:08 $
  *  $Revision: 1.1 $
  *  \author N. Amapane - Torino
  */
+#include <algorithm>
 #include <map>
 #include <string>
-#include <CommonTools/Utils/interface/StringCutObjectSelector.h>
+#include <vector>
+#include <HTauTauHMuMu/AnalysisStep/interface/CompiledCut.h>
 #include <FWCore/ParameterSet/interface/ParameterSet.h>
 
 
 template <typename T>
-class CutSet : public std::map<std::string,  StringCutObjectSelector<T, true>* >{
+class CutSet : public std::map<std::string,  CompiledCut<T>* >{
 public:
 
   /// Constructor: parse the ParameterSet and create the selectors.
   CutSet(const edm::ParameterSet& ps) {
     std::vector<std::string> cutNames = ps.getParameterNamesForType<std::string>();
+    std::vector<std::string> stringCuts = ps.getUntrackedParameter<std::vector<std::string> >("stringCuts", std::vector<std::string>());
+    bool validate = ps.getUntrackedParameter<bool>("validateCompiledCuts", false);
     for( unsigned i=0; i<cutNames.size(); ++i) {    
-      (*this)[cutNames[i]] = new StringCutObjectSelector<T, true>(ps.getParameter<std::string>(cutNames[i]));
+      bool useString = std::find(stringCuts.begin(), stringCuts.end(), cutNames[i]) != stringCuts.end();
+      (*this)[cutNames[i]] = new CompiledCut<T>(ps.getParameter<std::string>(cutNames[i]), validate, useString);
     }
   }
 
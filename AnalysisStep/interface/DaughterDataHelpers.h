@@ -20,16 +20,16 @@
 namespace userdatahelpers {
 
   /// Retrieve the userFloat "name" from a reco::Candidate c
-  float getUserFloat(const reco::Candidate* c, const char* name);
+  float getUserFloat(const reco::Candidate* c, const std::string& name);
 
   /// Test if the userFloat "name" from a reco::Candidate c exists
-  bool hasUserFloat(const reco::Candidate* c, const char* name);
+  bool hasUserFloat(const reco::Candidate* c, const std::string& name);
 
   /// Retrieve the userInt "name" from a reco::Candidate c
-  int getUserInt(const reco::Candidate* c, const char* name);
+  int getUserInt(const reco::Candidate* c, const std::string& name);
 
   /// Test if the userFloat "name" from a reco::Candidate c exists
-  bool hasUserInt(const reco::Candidate* c, const char* name);
+  bool hasUserInt(const reco::Candidate* c, const std::string& name);
   
   /// Retrieve matched photons stored as userData
   const PhotonPtrVector* getUserPhotons(const reco::Candidate* c);
@@ -0,0 +1,30 @@
+//--------------------------------------------------------------------------------------------------
+//
+// EffectiveAreaBins
+//
+// Effective areas in bins of |eta|, used for the table-driven lookups in
+// ElectronEffectiveArea and MuonEffectiveArea.
+// Bin i covers [lowEdge[i], lowEdge[i+1]), the last bin is open-ended;
+// values below the first edge (or NaN) get an effective area of 0.
+//
+//--------------------------------------------------------------------------------------------------
+
+#ifndef EffectiveAreaBins_H
+#define EffectiveAreaBins_H
+
+struct EffectiveAreaBins {
+  static constexpr unsigned int kMaxBins = 8;
+
+  unsigned int nBins;
+  double lowEdge[kMaxBins];
+  double area[kMaxBins];
+
+  /// Branchless bin search: count the lower edges that are not above absEta
+  constexpr double get(double absEta) const {
+    unsigned int n = 0;
+    for (unsigned int i=0; i<kMaxBins; ++i) n += (i<nBins) & (absEta>=lowEdge[i]);
+    return n==0 ? 0. : area[n-1];
+  }
+};
+
+#endif
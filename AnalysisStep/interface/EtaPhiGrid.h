@@ -0,0 +1,62 @@
+#ifndef EtaPhiGrid_h
+#define EtaPhiGrid_h
+
+/** \class EtaPhiGrid
+ *
+ *  Per-event spatial index of objects in (eta, phi).
+ *  Cells are at least cellSize wide in both directions, so every object
+ *  within dR < cellSize of a point is in the point's cell or in one of its
+ *  8 neighbours (phi wraps around; |eta| beyond etaMax is folded into the
+ *  outermost cells). Objects are stored by index in the caller's collection.
+ */
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+class EtaPhiGrid {
+public:
+  explicit EtaPhiGrid(double cellSize, double etaMax=5.)
+    : etaMax_(etaMax),
+      nEta_(std::max(1, int(2*etaMax/cellSize))),
+      nPhi_(std::max(1, int(2*M_PI/cellSize))) {}
+
+  /// Index objects 0..n-1, with eta(i) and phi(i) returning their coordinates
+  template<class Eta, class Phi> void build(size_t n, Eta eta, Phi phi) {
+    // Counting sort of the objects by cell
+    std::vector<unsigned> cell(n);
+    cellStart_.assign(nEta_*nPhi_+1, 0);
+    for (size_t i=0; i<n; ++i) {
+      cell[i] = etaCell(eta(i))*nPhi_ + phiCell(phi(i));
+      ++cellStart_[cell[i]+1];
+    }
+    for (int c=0; c<nEta_*nPhi_; ++c) cellStart_[c+1] += cellStart_[c];
+    index_.resize(n);
+    std::vector<unsigned> fill(cellStart_.begin(), cellStart_.end()-1);
+    for (size_t i=0; i<n; ++i) index_[fill[cell[i]]++] = i;
+  }
+
+  /// Call f(i) for every object in the cell of (eta, phi) and its neighbours
+  template<class F> void forEachNear(double eta, double phi, F f) const {
+    if (index_.empty()) return;
+    int ieta = etaCell(eta), iphi = phiCell(phi);
+    int dPhiMin = -1, dPhiMax = 1;
+    if (nPhi_ < 3) { iphi = 0; dPhiMin = 0; dPhiMax = nPhi_-1; }
+    for (int jeta = std::max(0, ieta-1); jeta <= std::min(nEta_-1, ieta+1); ++jeta) {
+      for (int dphi = dPhiMin; dphi <= dPhiMax; ++dphi) {
+        int c = jeta*nPhi_ + (iphi+dphi+nPhi_)%nPhi_;
+        for (unsigned k = cellStart_[c]; k < cellStart_[c+1]; ++k) f(index_[k]);
+      }
+    }
+  }
+
+private:
+  int etaCell(double eta) const { return std::min(nEta_-1, std::max(0, int((eta+etaMax_)*nEta_/(2*etaMax_)))); }
+  int phiCell(double phi) const { return std::min(nPhi_-1, std::max(0, int((phi+M_PI)*nPhi_/(2*M_PI)))); }
+
+  double etaMax_;
+  int nEta_, nPhi_;
+  std::vector<unsigned> cellStart_; // objects of cell c are index_[cellStart_[c]..cellStart_[c+1]]
+  std::vector<unsigned> index_;
+};
+#endif
@@ -39,6 +39,7 @@
 #include "RecoEgamma/ElectronIdentification/interface/VersionedPatElectronSelector.h"
 
 #include <vector>
+#include <array>
 #include "TVector3.h"
 #include "TLorentzVector.h"
 #include "TMath.h"
@@ -52,10 +53,27 @@ inline bool sort_CandidatesByPt(const reco::Candidate *a, const reco::Candidate
 
 namespace EwkCorrections
 {
-  std::vector<std::vector<float>> readFile_and_loadEwkTable(TString dtag);
-  std::vector<float> findCorrection(const std::vector<std::vector<float>> & Table_EWK, float sqrt_s_hat, float t_hat);
+  // Correction table as a (sqrt(s_hat), t_hat) grid: rows are grouped in blocks of constant sqrt(s_hat),
+  // with t_hat ascending within each block.
+  struct EwkTable {
+    std::vector<float> sAxis;                 // sqrt(s_hat) of each block, ascending
+    std::vector<unsigned int> blockBegin;     // first row of each block, plus one past the last row
+    std::vector<float> tAxis;                 // t_hat of each row
+    std::vector<std::array<float,3> > corr;   // corrections for quarks u/c, d/s, b of each row
+  };
+
+  // Parsed tables are cached by file name, so repeated calls do not re-read the file.
+  const EwkTable & readFile_and_loadEwkTable(TString dtag);
+  std::array<float,3> findCorrection(const EwkTable & Table_EWK, float sqrt_s_hat, float t_hat);
+  // |pdgId| of the leading incoming quark of the hardest subprocess (0 if none); also stored in GenSummary
+  int incomingQuarkFlavour(const edm::View<reco::Candidate> & particles);
   double getEwkCorrections(const edm::Handle<edm::View<reco::Candidate> > & particles, 
-                           const std::vector<std::vector<float>> & Table, 
+                           const EwkTable & Table, 
+                           const GenEventInfoProduct & eventInfo,
+                           TLorentzVector Z1, TLorentzVector Z2);
+  // Same, with the incoming quark flavour already known
+  double getEwkCorrections(int quark_type, 
+                           const EwkTable & Table, 
                            const GenEventInfoProduct & eventInfo,
                            TLorentzVector Z1, TLorentzVector Z2);
 }
@@ -0,0 +1,82 @@
+#ifndef GenSummary_h
+#define GenSummary_h
+
+/** \class GenSummary
+ *
+ *  Generator history of the event, as interpreted by MCHistoryTools, filled
+ *  once per event by GenSummaryProducer so that consumers do not redo the
+ *  gen particle scans. Particles are stored as indices into the gen particle
+ *  collection given to the producer (prunedGenParticles) and gen jets as
+ *  indices into the gen jet collection; -1 stands for none. The accessors
+ *  check that the collection passed is the one the indices refer to.
+ */
+
+#include <DataFormats/Common/interface/Handle.h>
+#include <DataFormats/Common/interface/View.h>
+#include <DataFormats/Provenance/interface/ProductID.h>
+#include <FWCore/Utilities/interface/Exception.h>
+
+#include <vector>
+
+struct GenSummary {
+  GenSummary() :
+    processID(0), hepMCweight(1.), finalState(-1), associatedFS(-1),
+    inEtaAcceptance(false), inEtaPtAcceptance(false),
+    higgs(-1), incomingQuarkFlavour(0), HTAll(0.), HTJet(0.) {}
+
+  /// Particle at index idx of the gen particle collection (0 for -1)
+  template<class T> const T* particle(const edm::Handle<edm::View<T> >& genParticles, int idx) const {
+    check(genParticles.id(), genParticlesID, "gen particle");
+    return (idx < 0 ? nullptr : &(*genParticles)[idx]);
+  }
+
+  /// Particles at the given indices of the gen particle collection (0 for -1)
+  template<class T> std::vector<const T*> particles(const edm::Handle<edm::View<T> >& genParticles, const std::vector<int>& idx) const {
+    check(genParticles.id(), genParticlesID, "gen particle");
+    std::vector<const T*> result;
+    result.reserve(idx.size());
+    for (int i : idx) result.push_back(i < 0 ? nullptr : &(*genParticles)[i]);
+    return result;
+  }
+
+  /// Gen jets at the given indices of the gen jet collection
+  template<class T> std::vector<const T*> jets(const edm::Handle<edm::View<T> >& genJets, const std::vector<int>& idx) const {
+    check(genJets.id(), genJetsID, "gen jet");
+    std::vector<const T*> result;
+    result.reserve(idx.size());
+    for (int i : idx) result.push_back(&(*genJets)[i]);
+    return result;
+  }
+
+  edm::ProductID genParticlesID;
+  edm::ProductID genJetsID;
+
+  unsigned int processID;
+  float hepMCweight;
+  int finalState;          // MCHistoryTools::genFinalState()
+  int associatedFS;        // MCHistoryTools::genAssociatedFS()
+  bool inEtaAcceptance;
+  bool inEtaPtAcceptance;
+
+  int higgs;
+  std::vector<int> vs;             // genVs()
+  std::vector<int> sortedLeps;     // sortedGenZZLeps()
+  std::vector<int> associatedLeps; // genAssociatedLeps()
+  std::vector<int> visLeps;        // sortedVisGenZZLeps()
+  std::vector<int> tauNus;         // genTauNus(), -1 where there is none
+  std::vector<int> fsr;            // genFSR()
+  std::vector<float> isolation;    // genIso(), one per sorted lepton
+  std::vector<int> cleanedGenJets; // GenCleanedJets()
+
+  std::vector<int> promptLeptons;  // e/mu with pt>8 that are prompt or direct prompt tau decay products
+  int incomingQuarkFlavour;        // |pdgId| of the leading incoming quark of the hard process (0 if none)
+
+  float HTAll;
+  float HTJet;
+
+private:
+  static void check(const edm::ProductID& id, const edm::ProductID& expected, const char* what) {
+    if (id != expected) throw cms::Exception("GenSummary") << "The " << what << " collection is not the one the GenSummary refers to";
+  }
+};
+#endif
@@ -0,0 +1,47 @@
+#ifndef JetShifts_h
+#define JetShifts_h
+
+/** \class JetShifts
+ *
+ *  Split JES uncertainties of a jet and the corresponding shifted pTs,
+ *  attached by JetFiller as a single userData instead of one userFloat per
+ *  source and direction, so that loops over the sources do one lookup per
+ *  jet. The combined uncertainty and the JER variations are still plain
+ *  userFloats (jes_unc, pt_jesup, pt_jesdn, pt_jerup, pt_jerdn).
+ */
+
+#include <DataFormats/PatCandidates/interface/Jet.h>
+#include <FWCore/Utilities/interface/Exception.h>
+
+#include <string>
+
+struct JetShifts {
+  static const unsigned nSources = 12;
+
+  /// Short names of the sources, in the order of the arrays
+  static const char* source(unsigned s) {
+    static const char* const names[nSources] = {
+      "Total", "Abs", "Abs_year", "BBEC1", "BBEC1_year", "EC2", "EC2_year",
+      "FlavQCD", "HF", "HF_year", "RelBal", "RelSample_year"
+    };
+    return names[s];
+  }
+
+  /// userData label
+  static const std::string& label() {
+    static const std::string l("jesShifts");
+    return l;
+  }
+
+  /// Shifts attached to a jet by JetFiller
+  static const JetShifts& get(const pat::Jet& jet) {
+    const JetShifts* shifts = jet.userData<JetShifts>(label());
+    if (shifts == nullptr) throw cms::Exception("JetShifts") << "Jet has no " << label() << " userData";
+    return *shifts;
+  }
+
+  float unc[nSources];   // relative uncertainty per source (symmetric)
+  float ptUp[nSources];  // pT shifted up
+  float ptDn[nSources];  // pT shifted down
+};
+#endif
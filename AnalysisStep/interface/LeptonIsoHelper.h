@@ -15,6 +15,7 @@
 #include <DataFormats/PatCandidates/interface/Tau.h>
 
 #include <DataFormats/ParticleFlowCandidate/interface/PFCandidate.h>
+#include <HTauTauHMuMu/AnalysisStep/interface/PFCandidateIndex.h>
 
 namespace LeptonIsoHelper {
 
@@ -40,8 +41,8 @@ namespace LeptonIsoHelper {
 
   float combRelIsoPF(const pat::Tau& l);
 
-  // Compute FSR isolation
-  void fsrIso(const reco::PFCandidate* photon, edm::Handle<edm::View<pat::PackedCandidate> > pfcands, double& ptSumNe, double& ptSumCh, double& ptSumChByWorstPV);
+  // Compute FSR isolation; pfcands must be indexed with a cone of at least 0.3
+  void fsrIso(const reco::PFCandidate* photon, const PFCandidateIndex& pfcands, double& ptSumNe, double& ptSumCh, double& ptSumChByWorstPV);
 
   // Value of the iso cut 
   float isoCut(const reco::Candidate* d);
@@ -0,0 +1,38 @@
+#ifndef METShifts_h
+#define METShifts_h
+
+/** \class METShifts
+ *
+ *  Layout of the pat::METCollection produced by the ShiftMET module:
+ *  the raw MET, the MET with the central tau and jet corrections (and with
+ *  each of them alone), then an up and a down variation per systematic
+ *  source. All the variations are shifts of the raw MET.
+ */
+
+#include <HTauTauHMuMu/AnalysisStep/interface/JetShifts.h>
+
+namespace METShifts {
+
+  enum Central {
+    kRaw = 0,  // input MET
+    kCentral,  // central tau and jet corrections
+    kTauOnly,  // central tau corrections only
+    kJetOnly,  // central jet corrections only
+    nCentral
+  };
+
+  enum Source {
+    kJES = 0,            // first of the split JES sources, in the order of JetShifts
+    kJER = kJES + JetShifts::nSources,
+    kTES,                // tau energy scale
+    kEES,                // e->tau fake energy scale
+    kMES,                // mu->tau fake energy scale
+    nSources
+  };
+
+  /// Position of a variation in the collection
+  inline unsigned index(unsigned source, bool up) { return nCentral + 2*source + (up ? 0 : 1); }
+
+  const unsigned size = nCentral + 2*nSources;
+}
+#endif
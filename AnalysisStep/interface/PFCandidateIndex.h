@@ -0,0 +1,46 @@
+#ifndef PFCandidateIndex_h
+#define PFCandidateIndex_h
+
+/** \class PFCandidateIndex
+ *
+ *  Per-event eta-phi index of the packed PF candidates, for custom isolation
+ *  sums. Build it once per event with the largest cone that will be used;
+ *  forEachInCone() then visits only the candidates of the nearby cells, in
+ *  collection order, so sums come out exactly as in a loop over the full
+ *  collection.
+ */
+
+#include <DataFormats/Common/interface/View.h>
+#include <DataFormats/PatCandidates/interface/PackedCandidate.h>
+#include <HTauTauHMuMu/AnalysisStep/interface/EtaPhiGrid.h>
+
+#include <vector>
+#include <algorithm>
+
+class PFCandidateIndex {
+public:
+  PFCandidateIndex(const edm::View<pat::PackedCandidate>& pfcands, double maxCone)
+    : cands_(pfcands),
+      grid_(1.1*maxCone) // margin for the rounding between the p4 and the polar eta/phi
+  {
+    grid_.build(pfcands.size(),
+                [&](size_t i) { return pfcands[i].eta(); },
+                [&](size_t i) { return pfcands[i].phi(); });
+  }
+
+  const edm::View<pat::PackedCandidate>& candidates() const { return cands_; }
+
+  /// Call f(cand) for the candidates that can be within maxCone of (eta, phi), in collection order
+  template<class F> void forEachInCone(double eta, double phi, F f) const {
+    near_.clear();
+    grid_.forEachNear(eta, phi, [this](unsigned i) { near_.push_back(i); });
+    std::sort(near_.begin(), near_.end());
+    for (unsigned i : near_) f(cands_[i]);
+  }
+
+private:
+  const edm::View<pat::PackedCandidate>& cands_;
+  EtaPhiGrid grid_;
+  mutable std::vector<unsigned> near_; // scratch space, reused between calls
+};
+#endif
@@ -6,22 +6,47 @@
  *  Implement PU reweighting.
  *  To prepare PU profile histograms, cf. utils/make_PU_weight_hist.py
  *
+ *  The nominal and varied weight histograms are flattened at construction, 
+ *  so that all variations are read with a single bin lookup.
  */
 
 #include <TH1F.h>
 #include <TFile.h>
 #include <string>
+#include <vector>
 
 class PileUpWeight {
 public:
   enum class PUvar : int {NOMINAL=0, VARUP=1, VARDOWN=2};
+  enum class Era : int {UL2016APV=0, UL2016=1, UL2017=2, UL2018=3};
 
-  PileUpWeight(int MC, int target); 
+  struct Weights {
+    float nominal;
+    float up;
+    float down;
+  };
 
-  float weight(float input, PUvar var = PUvar::NOMINAL);
+  explicit PileUpWeight(Era era);
 
-  std::unique_ptr<TH1> h_nominal;
-  std::unique_ptr<TH1> h_up;
-  std::unique_ptr<TH1> h_down;
+  /// Select the era from the MC and data years; preVFP picks 2016APV for 2016.
+  PileUpWeight(int MC, int target, bool preVFP=false);
+
+  /// All variations for a given true number of interactions (-1 if not available)
+  Weights weights(float nTrueInt) const;
+
+  float weight(float input, PUvar var = PUvar::NOMINAL) const;
+
+private:
+  void init(Era era);
+  void fill(const TH1* h, PUvar var);
+  int findBin(float input) const;
+
+  // Binning of the weight histograms, as in TAxis::FindFixBin
+  int nBins_;
+  double xMin_;
+  double xMax_;
+  std::vector<double> edges_;   // filled only for variable binning
+  // Bin contents for each PUvar, including underflow and overflow
+  std::vector<float> w_[3];
 };
 #endif
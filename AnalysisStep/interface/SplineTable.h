@@ -0,0 +1,76 @@
+#ifndef SplineTable_h
+#define SplineTable_h
+
+/** \class SplineTable
+ *
+ *  Constant-time replacement for TSpline3::Eval.
+ *  The cubic coefficients of the spline are copied at construction and a
+ *  uniform grid over [xmin, xmax] maps each x to its knot interval, so that
+ *  no search is needed per call. Outside the range the spline is extended
+ *  linearly from its end points.
+ *
+ *  GraphTable does the same for the linear interpolation of TGraph::Eval
+ *  (points sorted in x), and also returns the y error of the point below x.
+ */
+
+#include <vector>
+
+class TSpline3;
+class TGraphErrors;
+
+namespace interpolation {
+  // Uniform grid over sorted knots; below(x) is the largest k with knot[k] < x.
+  class KnotIndex {
+  public:
+    KnotIndex() : xMin_(0.), invStep_(0.) {}
+    void build(const std::vector<double>& knots, unsigned cellsPerKnot);
+    int below(const std::vector<double>& knots, double x) const;
+
+  private:
+    double xMin_;
+    double invStep_;
+    std::vector<int> first_; // below() at the low edge of each cell
+  };
+}
+
+
+class SplineTable {
+public:
+  SplineTable() {}
+  explicit SplineTable(const TSpline3* sp, unsigned cellsPerKnot=4);
+
+  bool empty() const { return x_.empty(); }
+
+  /// As TSpline3::Eval
+  double eval(double x) const;
+
+  /// As TSpline3::Eval inside the knot range, linear extrapolation outside
+  double evalExtrapolated(double x) const;
+
+private:
+  int findKnot(double x) const;
+
+  std::vector<double> x_, y_, b_, c_, d_;
+  interpolation::KnotIndex index_;
+};
+
+
+class GraphTable {
+public:
+  GraphTable() {}
+  explicit GraphTable(const TGraphErrors* gr, unsigned cellsPerPoint=4);
+
+  bool empty() const { return x_.empty(); }
+
+  /// As TGraph::Eval (linear interpolation, linear extrapolation)
+  double eval(double x) const;
+
+  /// Error on the point preceding x, or on the first point if x is not
+  /// strictly between two points
+  double errorY(double x) const;
+
+private:
+  std::vector<double> x_, y_, ey_;
+  interpolation::KnotIndex index_;
+};
+#endif
@@ -0,0 +1,30 @@
+#ifndef UserFloatKeys_h
+#define UserFloatKeys_h
+
+/** \class UserFloatKeys
+ *
+ *  Table of userFloat/userInt labels of the form prefix+name+suffix, built
+ *  once (e.g. at module construction) for lookups in event loops. The pat
+ *  accessors take a const std::string&, so passing a concatenation or a
+ *  literal instead builds a new string at every call.
+ */
+
+#include <string>
+#include <vector>
+
+class UserFloatKeys {
+public:
+  UserFloatKeys() {}
+
+  UserFloatKeys(const std::string& prefix, const std::vector<std::string>& names, const std::string& suffix="") {
+    keys_.reserve(names.size());
+    for (const std::string& name : names) keys_.push_back(prefix + name + suffix);
+  }
+
+  const std::string& operator[](size_t i) const { return keys_[i]; }
+  size_t size() const { return keys_.size(); }
+
+private:
+  std::vector<std::string> keys_;
+};
+#endif
@@ -11,7 +11,7 @@
  */
 
 #include <FWCore/Framework/interface/Frameworkfwd.h>
-#include <FWCore/Framework/interface/EDProducer.h>
+#include <FWCore/Framework/interface/stream/EDProducer.h>
 #include <FWCore/Framework/interface/Event.h>
 #include <FWCore/ParameterSet/interface/ParameterSet.h>
 #include <FWCore/Framework/interface/ESHandle.h>
@@ -32,7 +32,7 @@ using namespace reco;
 
 
 
-class EleFiller : public edm::EDProducer {
+class EleFiller : public edm::stream::EDProducer<> {
  public:
   /// Constructor
   explicit EleFiller(const edm::ParameterSet&);
@@ -41,9 +41,7 @@ class EleFiller : public edm::EDProducer {
   ~EleFiller();
 
  private:
-  virtual void beginJob(){};  
-  virtual void produce(edm::Event&, const edm::EventSetup&);
-  virtual void endJob(){};
+  void produce(edm::Event&, const edm::EventSetup&) override;
 
   edm::EDGetTokenT<pat::ElectronRefVector> electronToken;
   edm::EDGetTokenT<pat::ElectronRefVector> electronToken_bis;
@@ -52,7 +50,7 @@ class EleFiller : public edm::EDProducer {
   // const edm::EDGetTokenT< edm::TriggerResults > triggerResultsToken_;
   int sampleType;
   int setup;
-  const StringCutObjectSelector<pat::Electron, true> cut;
+  const CompiledCut<pat::Electron> cut;
   const CutSet<pat::Electron> flags;
   edm::EDGetTokenT<double> rhoToken;
   edm::EDGetTokenT<vector<Vertex> > vtxToken;
@@ -7,7 +7,7 @@
 */
 
 #include <FWCore/Framework/interface/Frameworkfwd.h>
-#include <FWCore/Framework/interface/EDProducer.h>
+#include <FWCore/Framework/interface/global/EDProducer.h>
 #include <FWCore/Framework/interface/Event.h>
 #include <FWCore/Framework/interface/ESHandle.h>
 #include <FWCore/MessageLogger/interface/MessageLogger.h>
@@ -25,7 +25,7 @@ using namespace edm;
 using namespace std;
 using namespace reco;
 
-class ExtractMETSignificance : public edm::EDProducer {
+class ExtractMETSignificance : public edm::global::EDProducer<> {
     public: 
         /// Constructor
         explicit ExtractMETSignificance(const edm::ParameterSet&);
@@ -33,9 +33,7 @@ class ExtractMETSignificance : public edm::EDProducer {
         ~ExtractMETSignificance(){};  
 
     private:
-        virtual void beginJob(){};  
-        virtual void produce(edm::Event&, const edm::EventSetup&);
-        virtual void endJob(){};
+        void produce(edm::StreamID, edm::Event&, const edm::EventSetup&) const override;
 
         edm::EDGetTokenT<View<pat::MET>> theMETTag;
 };
@@ -47,7 +45,7 @@ theMETTag(consumes<View<pat::MET>>(iConfig.getParameter<edm::InputTag>("srcMET")
     produces<math::Error<2>::type>("METCovariance");
 }
 
-void ExtractMETSignificance::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
+void ExtractMETSignificance::produce(edm::StreamID, edm::Event& iEvent, const edm::EventSetup& iSetup) const
 {
     Handle<View<pat::MET> > METHandle;
     iEvent.getByToken(theMETTag, METHandle);
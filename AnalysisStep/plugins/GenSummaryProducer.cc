@@ -0,0 +1,123 @@
+/** \class GenSummaryProducer
+ *
+ *  Runs the MCHistoryTools analysis of the generator history once per event
+ *  and stores the result as a GenSummary, for LLNtupleMaker, TauFiller and
+ *  any other consumer of the MC truth.
+ */
+
+#include <FWCore/Framework/interface/Frameworkfwd.h>
+#include <FWCore/Framework/interface/global/EDProducer.h>
+#include <FWCore/Framework/interface/Event.h>
+#include <FWCore/ParameterSet/interface/ParameterSet.h>
+#include <FWCore/Utilities/interface/InputTag.h>
+#include <FWCore/Utilities/interface/Exception.h>
+#include <DataFormats/HepMCCandidate/interface/GenParticle.h>
+
+#include <HTauTauHMuMu/AnalysisStep/interface/GenSummary.h>
+#include <HTauTauHMuMu/AnalysisStep/interface/MCHistoryTools.h>
+#include <HTauTauHMuMu/AnalysisStep/interface/EwkCorrections.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+using namespace edm;
+
+class GenSummaryProducer : public edm::global::EDProducer<> {
+public:
+  explicit GenSummaryProducer(const edm::ParameterSet&);
+  ~GenSummaryProducer() {}
+
+private:
+  void produce(edm::StreamID, edm::Event&, const edm::EventSetup&) const override;
+
+  edm::EDGetTokenT<edm::View<reco::Candidate> > genParticleToken;
+  edm::EDGetTokenT<GenEventInfoProduct> genInfoToken;
+  edm::EDGetTokenT<edm::View<reco::GenJet> > genJetsToken;
+  edm::EDGetTokenT<edm::View<pat::PackedGenParticle> > packedGenParticlesToken;
+  const std::string sampleName;
+};
+
+
+GenSummaryProducer::GenSummaryProducer(const edm::ParameterSet& iConfig) :
+  genParticleToken(consumes<edm::View<reco::Candidate> >(iConfig.getParameter<edm::InputTag>("genParticles"))),
+  genInfoToken(consumes<GenEventInfoProduct>(iConfig.getParameter<edm::InputTag>("genInfo"))),
+  genJetsToken(consumes<edm::View<reco::GenJet> >(iConfig.getParameter<edm::InputTag>("genJets"))),
+  packedGenParticlesToken(consumes<edm::View<pat::PackedGenParticle> >(iConfig.getParameter<edm::InputTag>("packedGenParticles"))),
+  sampleName(iConfig.getParameter<std::string>("sampleName"))
+{
+  produces<GenSummary>();
+}
+
+
+void GenSummaryProducer::produce(edm::StreamID, edm::Event& iEvent, const edm::EventSetup&) const
+{
+  Handle<View<reco::Candidate> > genParticles;
+  iEvent.getByToken(genParticleToken, genParticles);
+  Handle<GenEventInfoProduct> genInfo;
+  iEvent.getByToken(genInfoToken, genInfo);
+  Handle<View<reco::GenJet> > genJets;
+  iEvent.getByToken(genJetsToken, genJets);
+  Handle<View<pat::PackedGenParticle> > packedGenParticles;
+  iEvent.getByToken(packedGenParticlesToken, packedGenParticles);
+
+  std::unique_ptr<GenSummary> summary(new GenSummary());
+  summary->genParticlesID = genParticles.id();
+  summary->genJetsID = genJets.id();
+
+  // Position of each gen particle and gen jet in its collection
+  std::unordered_map<const reco::Candidate*, int> particleIdx;
+  particleIdx.reserve(genParticles->size());
+  for (unsigned i = 0; i < genParticles->size(); ++i) particleIdx[&(*genParticles)[i]] = i;
+  std::unordered_map<const reco::Candidate*, int> jetIdx;
+  for (unsigned i = 0; i < genJets->size(); ++i) jetIdx[&(*genJets)[i]] = i;
+
+  auto indexOf = [](const std::unordered_map<const reco::Candidate*, int>& idx, const reco::Candidate* c) {
+    if (c == nullptr) return -1;
+    std::unordered_map<const reco::Candidate*, int>::const_iterator i = idx.find(c);
+    if (i == idx.end()) throw cms::Exception("GenSummaryProducer") << "Particle not found in the input collection";
+    return i->second;
+  };
+  auto indicesOf = [&indexOf](const std::unordered_map<const reco::Candidate*, int>& idx, const auto& cands) {
+    std::vector<int> result;
+    result.reserve(cands.size());
+    for (const reco::Candidate* c : cands) result.push_back(indexOf(idx, c));
+    return result;
+  };
+
+  MCHistoryTools mch(iEvent, sampleName, genParticles, genInfo, genJets, packedGenParticles);
+  summary->processID    = mch.getProcessID();
+  summary->hepMCweight  = mch.gethepMCweight();
+  summary->finalState   = mch.genFinalState();
+  summary->associatedFS = mch.genAssociatedFS();
+  mch.genAcceptance(summary->inEtaAcceptance, summary->inEtaPtAcceptance);
+
+  summary->higgs          = indexOf(particleIdx, mch.genH());
+  summary->vs             = indicesOf(particleIdx, mch.genVs());
+  summary->sortedLeps     = indicesOf(particleIdx, mch.sortedGenZZLeps());
+  summary->associatedLeps = indicesOf(particleIdx, mch.genAssociatedLeps());
+  summary->visLeps        = indicesOf(particleIdx, mch.sortedVisGenZZLeps());
+  summary->tauNus         = indicesOf(particleIdx, mch.genTauNus());
+  summary->fsr            = indicesOf(particleIdx, mch.genFSR());
+  summary->isolation      = mch.genIso();
+  summary->cleanedGenJets = indicesOf(jetIdx, mch.GenCleanedJets());
+  summary->HTAll = mch.getHTAll();
+  summary->HTJet = mch.getHTJet();
+
+  // Candidates for the gen matching of taus to prompt electrons and muons
+  for (unsigned i = 0; i < genParticles->size(); ++i) {
+    const reco::GenParticle& genP = static_cast<const reco::GenParticle&>((*genParticles)[i]);
+    int id = std::abs(genP.pdgId());
+    if (genP.pt() > 8. && (id == 11 || id == 13) && (genP.statusFlags().isPrompt() || genP.statusFlags().isDirectPromptTauDecayProduct())) {
+      summary->promptLeptons.push_back(i);
+    }
+  }
+  summary->incomingQuarkFlavour = EwkCorrections::incomingQuarkFlavour(*genParticles);
+
+  iEvent.put(std::move(summary));
+}
+
+
+#include <FWCore/Framework/interface/MakerMacros.h>
+DEFINE_FWK_MODULE(GenSummaryProducer);
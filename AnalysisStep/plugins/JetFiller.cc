@@ -1,9 +1,10 @@
 #include <FWCore/Framework/interface/Frameworkfwd.h>
-#include <FWCore/Framework/interface/EDProducer.h>
+#include <FWCore/Framework/interface/stream/EDProducer.h>
 #include <FWCore/Framework/interface/Event.h>
 #include <FWCore/ParameterSet/interface/ParameterSet.h>
 #include <FWCore/Framework/interface/ESHandle.h>
 #include <FWCore/Framework/interface/EventSetup.h>
+#include <FWCore/Framework/interface/ESWatcher.h>
 #include <FWCore/Utilities/interface/EDMException.h>
 
 #include <DataFormats/PatCandidates/interface/Jet.h>
@@ -11,24 +12,28 @@
 #include <CondFormats/JetMETObjects/interface/JetCorrectorParameters.h>
 #include <JetMETCorrections/Objects/interface/JetCorrectionsRecord.h>
 #include <JetMETCorrections/Modules/interface/JetResolution.h>
+#include <CondFormats/DataRecord/interface/JetResolutionRcd.h>
+#include <CondFormats/DataRecord/interface/JetResolutionScaleFactorRcd.h>
 
 #include <DataFormats/Math/interface/deltaR.h>
 
 #include <HTauTauHMuMu/AnalysisStep/interface/CutSet.h>
 #include <HTauTauHMuMu/AnalysisStep/interface/LeptonIsoHelper.h>
 #include <HTauTauHMuMu/AnalysisStep/interface/BTaggingSFHelper.h>
+#include <HTauTauHMuMu/AnalysisStep/interface/JetShifts.h>
 
 #include "TRandom3.h"
 
 #include <vector>
 #include <string>
+#include <memory>
 
 using namespace edm;
 using namespace std;
 using namespace reco;
 
 
-class JetFiller : public edm::EDProducer {
+class JetFiller : public edm::stream::EDProducer<> {
  public:
   /// Constructor
   explicit JetFiller(const edm::ParameterSet&);
@@ -37,14 +42,27 @@ class JetFiller : public edm::EDProducer {
   ~JetFiller(){};  
 
  private:
-  virtual void beginJob(){};  
-  virtual void produce(edm::Event&, const edm::EventSetup&);
-  virtual void endJob(){};
+  void produce(edm::Event&, const edm::EventSetup&) override;
+
+  /// Up uncertainty of every split JEC source (symmetric), in the order of uncSources
+  void getSplitUncertainties(float eta, float pt, std::vector<float>& unc);
+
+  /// Kinematics of all jets for the JER step, as a structure of arrays
+  struct JERInput {
+    std::vector<double> pt, eta, phi;
+    std::vector<double> genPt, genEta, genPhi; // genPt<0 if there is no gen jet
+  };
+  /// JER-corrected pT of all jets, with the SF up/down variations
+  struct JEROutput {
+    std::vector<float> pt, ptUp, ptDn;
+  };
+  /// Hybrid JER: scaling for jets matched to a gen jet, stochastic smearing for the others
+  void smearJets(const JERInput& in, double rho, JEROutput& out) const;
 
   edm::EDGetTokenT<edm::View<pat::Jet> > jetToken;
   int sampleType;
   int setup;
-  const StringCutObjectSelector<pat::Jet, true> cut;
+  const CompiledCut<pat::Jet> cut;
   bool isMC_;
   const std::string bTaggerName;
   float bTaggerThreshold;
@@ -64,10 +82,13 @@ class JetFiller : public edm::EDProducer {
 
   JME::JetResolution resolution;
   JME::JetResolutionScaleFactor resolution_sf;
+  // Resolution objects are only re-read when their IOV changes
+  edm::ESWatcher<JetResolutionRcd> resolutionWatcher;
+  edm::ESWatcher<JetResolutionScaleFactorRcd> resolutionSFWatcher;
     
   std::string jecUncFile_;
   std::vector<string> uncSources {};
-  std::vector<JetCorrectionUncertainty*> splittedUncerts_;
+  std::vector<std::unique_ptr<JetCorrectionUncertainty> > splittedUncerts_;
 };
 
 
@@ -138,6 +159,75 @@ JetFiller::JetFiller(const edm::ParameterSet& iConfig) :
       uncSources.push_back("RelativeSample_2018");
     }
   else cout << "jecUncFile NOT FOUND!";
+
+  // JEC uncertainty sources, parsed once from the text file
+  if(applyJEC_)
+    {
+      for (unsigned s_unc = 0; s_unc < uncSources.size(); s_unc++)
+	{
+	  JetCorrectorParameters corrParams(jecUncFile_, uncSources[s_unc]);
+	  splittedUncerts_.emplace_back(new JetCorrectionUncertainty(corrParams));
+	}
+    }
+}
+
+
+void JetFiller::getSplitUncertainties(float eta, float pt, std::vector<float>& unc)
+{
+  unc.resize(splittedUncerts_.size());
+  for (unsigned s_unc = 0; s_unc < splittedUncerts_.size(); s_unc++){
+    splittedUncerts_[s_unc]->setJetEta(eta);
+    splittedUncerts_[s_unc]->setJetPt(pt);
+    unc[s_unc] = splittedUncerts_[s_unc]->getUncertainty(true); //It takes as argument "bool fDirection": true = up, false = dn; symmetric values
+  }
+}
+
+
+void JetFiller::smearJets(const JERInput& in, double rho, JEROutput& out) const
+{
+  size_t n = in.pt.size();
+  out.pt.resize(n);
+  out.ptUp.resize(n);
+  out.ptDn.resize(n);
+
+  for (size_t i = 0; i < n; ++i) {
+    double jpt = in.pt[i];
+    double jeta = in.eta[i];
+    double jphi = in.phi[i];
+
+    JME::JetParameters res_parameters = {{JME::Binning::JetPt, jpt}, {JME::Binning::JetEta, jeta}, {JME::Binning::Rho, rho}};
+    float res_pt  = resolution.getResolution(res_parameters);
+
+    //JME::JetParameters sf_parameters = {{JME::Binning::JetEta, jeta}, {JME::Binning::Rho, rho}};
+    JME::JetParameters sf_parameters = {{JME::Binning::JetPt, jpt}, {JME::Binning::JetEta, jeta}, {JME::Binning::Rho, rho}};
+    float sf    = resolution_sf.getScaleFactor(sf_parameters);
+    float sf_up = resolution_sf.getScaleFactor(sf_parameters, Variation::UP);
+    float sf_dn = resolution_sf.getScaleFactor(sf_parameters, Variation::DOWN);
+
+    //- check matching to gen jets
+    bool matchedJet = in.genPt[i] >= 0
+                      && ( reco::deltaR(jeta,jphi,in.genEta[i],in.genPhi[i]) < 0.2 )
+                      && ( fabs(jpt-in.genPt[i]) < 3*res_pt*jpt );
+
+    if(matchedJet){
+      //- apply scaling
+      float gen_pt = in.genPt[i];
+      out.pt[i]   = max( 0., gen_pt + sf   *(jpt-gen_pt) );
+      out.ptUp[i] = max( 0., gen_pt + sf_up*(jpt-gen_pt) );
+      out.ptDn[i] = max( 0., gen_pt + sf_dn*(jpt-gen_pt) );
+    }else{
+      //- apply smearing
+      TRandom3 rand;
+      rand.SetSeed(abs(static_cast<int>(sin(jphi)*100000)));
+      float smear = rand.Gaus(0,1.);
+      float sigma   = sqrt(sf   *sf   -1.) * res_pt*jpt;
+      float sigmaup = sqrt(sf_up*sf_up-1.) * res_pt*jpt;
+      float sigmadn = sqrt(sf_dn*sf_dn-1.) * res_pt*jpt;
+      out.pt[i]   = max( 0., smear*sigma   + jpt );
+      out.ptUp[i] = max( 0., smear*sigmaup + jpt );
+      out.ptDn[i] = max( 0., smear*sigmadn + jpt );
+    }
+  }
 }
 
 
@@ -173,19 +263,28 @@ JetFiller::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
   // JEC uncertainty (Part 2) - Splitting (May 2020)
   // Run 2 reduced set of uncertainties from here: https://twiki.cern.ch/twiki/bin/viewauth/CMS/JECUncertaintySources#Run_2_reduced_set_of_uncertainty
   // List of uncertainties: ['Absolute', 'Absolute_201*', 'BBEC1', 'BBEC1_201*', 'EC2', 'EC2_201*', 'FlavorQCD', 'HF', 'HF_201*', 'RelativeBal', 'RelativeSample_201*'] + 'Total'
-  // if(applyJEC_ && isMC_)
-  if(applyJEC_)
-    {
-    // cout<<jecUncFile_<<endl;
-      for (unsigned s_unc = 0; s_unc < uncSources.size(); s_unc++)
-	{
-	  // cout<<uncSources[s_unc]<<", ";
-    JetCorrectorParameters corrParams = JetCorrectorParameters(jecUncFile_, uncSources[s_unc]);
-	  splittedUncerts_.push_back(new JetCorrectionUncertainty(corrParams));
-	}
-  // cout<<endl;
-    }
+  // The sources are built in the constructor (splittedUncerts_).
+  vector<float> jes_unc_split;
     
+  //--- JER for the whole collection ('hybrid' method)
+  JEROutput jer;
+  if(isMC_ && applyJER_){
+    if (resolutionWatcher.check(iSetup)) resolution = JME::JetResolution::get(iSetup, jerType+"_pt");
+    if (resolutionSFWatcher.check(iSetup)) resolution_sf = JME::JetResolutionScaleFactor::get(iSetup, jerType);
+
+    JERInput jerIn;
+    for (const pat::Jet& jet : *jetHandle) {
+      jerIn.pt.push_back(jet.pt());
+      jerIn.eta.push_back(jet.eta());
+      jerIn.phi.push_back(jet.phi());
+      const reco::GenJet* genJet = jet.genJet();
+      jerIn.genPt.push_back(genJet ? genJet->pt() : -1.);
+      jerIn.genEta.push_back(genJet ? genJet->eta() : 0.);
+      jerIn.genPhi.push_back(genJet ? genJet->phi() : 0.);
+    }
+    smearJets(jerIn, rho, jer);
+  }
+
   //--- Output collection
   auto result = std::make_unique<pat::JetCollection>();
   int jet_number=0;
@@ -377,45 +476,10 @@ JetFiller::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
     float pt_jerdn = -1.;
 
     if(isMC_ && applyJER_){
-      resolution = JME::JetResolution::get(iSetup, jerType+"_pt");
-      resolution_sf = JME::JetResolutionScaleFactor::get(iSetup, jerType);
-
-
-      JME::JetParameters res_parameters = {{JME::Binning::JetPt, jpt}, {JME::Binning::JetEta, jeta}, {JME::Binning::Rho, rho}};
-      float res_pt  = resolution.getResolution(res_parameters);
-
-      //JME::JetParameters sf_parameters = {{JME::Binning::JetEta, jeta}, {JME::Binning::Rho, rho}};
-      JME::JetParameters sf_parameters = {{JME::Binning::JetPt, jpt}, {JME::Binning::JetEta, jeta}, {JME::Binning::Rho, rho}};
-      float sf    = resolution_sf.getScaleFactor(sf_parameters);
-      float sf_up = resolution_sf.getScaleFactor(sf_parameters, Variation::UP);
-      float sf_dn = resolution_sf.getScaleFactor(sf_parameters, Variation::DOWN);
-
-      //-- 'hybrid' method = scaling for well matched jets, smearing for the rest
-
-      //- check matching to gen jets
-      const reco::GenJet* genJet = j.genJet();
-      bool matchedJet = genJet
-                        && ( reco::deltaR(jeta,jphi,genJet->eta(),genJet->phi()) < 0.2 )
-                        && ( fabs(jpt-genJet->pt()) < 3*res_pt*jpt );
-
-      if(matchedJet){
-	//- apply scaling
-	float gen_pt = genJet->pt();
-	pt_jer   = max( 0., gen_pt + sf   *(jpt-gen_pt) );
-	pt_jerup = max( 0., gen_pt + sf_up*(jpt-gen_pt) );
-	pt_jerdn = max( 0., gen_pt + sf_dn*(jpt-gen_pt) );
-      }else{
-	//- apply smearing
-	TRandom3 rand;
-	rand.SetSeed(abs(static_cast<int>(sin(jphi)*100000)));
-	float smear = rand.Gaus(0,1.);
-	float sigma   = sqrt(sf   *sf   -1.) * res_pt*jpt;
-	float sigmaup = sqrt(sf_up*sf_up-1.) * res_pt*jpt;
-	float sigmadn = sqrt(sf_dn*sf_dn-1.) * res_pt*jpt;
-	pt_jer   = max( 0., smear*sigma   + jpt );
-	pt_jerup = max( 0., smear*sigmaup + jpt );
-	pt_jerdn = max( 0., smear*sigmadn + jpt );
-      } 
+      size_t ijet = jet - jetHandle->begin();
+      pt_jer   = jer.pt[ijet];
+      pt_jerup = jer.ptUp[ijet];
+      pt_jerdn = jer.ptDn[ijet];
 
       j.setP4(reco::Particle::PolarLorentzVector(pt_jer, jeta, jphi, (pt_jer/jpt)*j.mass()));
     }
@@ -427,30 +491,18 @@ JetFiller::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
     float pt_jesup = j.pt() * (1.0 + jes_unc); // set the shifted pT up
     float pt_jesdn = j.pt() * (1.0 - jes_unc); // set the shifted pT dn
 
-    vector<float> jes_unc_split {};
-    vector<float> pt_jesup_split {};
-    vector<float> pt_jesdn_split {};
-    float singleContr_jes_unc = 0;
+    vector<float> pt_jesup_split(uncSources.size(), -999.);
+    vector<float> pt_jesdn_split(uncSources.size(), -999.);
 
-      
     if(applyJEC_){
+      getSplitUncertainties(j.eta(), j.pt(), jes_unc_split);
       for (unsigned s_unc = 0; s_unc < uncSources.size(); s_unc++){
-        singleContr_jes_unc = 0;
-        splittedUncerts_[s_unc]->setJetEta(j.eta());
-        splittedUncerts_[s_unc]->setJetPt(j.pt());
-        singleContr_jes_unc = splittedUncerts_[s_unc]->getUncertainty(true); //It takes as argument "bool fDirection": true = up, false = dn; symmetric values
-        jes_unc_split.push_back(singleContr_jes_unc);
-        pt_jesup_split.push_back( j.pt() * (1.0 + singleContr_jes_unc));
-        pt_jesdn_split.push_back( j.pt() * (1.0 - singleContr_jes_unc));
-
+        pt_jesup_split[s_unc] = j.pt() * (1.0 + jes_unc_split[s_unc]);
+        pt_jesdn_split[s_unc] = j.pt() * (1.0 - jes_unc_split[s_unc]);
       }
     }else{
-      for(unsigned s_unc = 0; s_unc < uncSources.size(); s_unc++){
-        jes_unc_split.push_back(-999.);
-        pt_jesup_split.push_back(-999.);
-        pt_jesdn_split.push_back(-999.);
-       }
-     }
+      jes_unc_split.assign(uncSources.size(), -999.);
+    }
       
     //--- Embed user variables
     j.addUserFloat("qgLikelihood",qgLikelihood);
@@ -461,45 +513,14 @@ JetFiller::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
     j.addUserFloat("pt_jesup", pt_jesup);
     j.addUserFloat("pt_jesdn", pt_jesdn);
       
-    // Adding variables to take into account single contributions to the total JEC uncertainty:
-    // UNCERTAINTY...
-    j.addUserFloat("jes_unc_split_Total", jes_unc_split[0]);
-    j.addUserFloat("jes_unc_split_Abs", jes_unc_split[1]);
-    j.addUserFloat("jes_unc_split_Abs_year", jes_unc_split[2]);
-    j.addUserFloat("jes_unc_split_BBEC1", jes_unc_split[3]);
-    j.addUserFloat("jes_unc_split_BBEC1_year", jes_unc_split[4]);
-    j.addUserFloat("jes_unc_split_EC2", jes_unc_split[5]);
-    j.addUserFloat("jes_unc_split_EC2_year", jes_unc_split[6]);
-    j.addUserFloat("jes_unc_split_FlavQCD", jes_unc_split[7]);
-    j.addUserFloat("jes_unc_split_HF", jes_unc_split[8]);
-    j.addUserFloat("jes_unc_split_HF_year", jes_unc_split[9]);
-    j.addUserFloat("jes_unc_split_RelBal", jes_unc_split[10]);
-    j.addUserFloat("jes_unc_split_RelSample_year", jes_unc_split[11]);
-    // ... and pT UP/DN VARIATIONS
-    j.addUserFloat("pt_jesup_split_Total", pt_jesup_split[0]);
-    j.addUserFloat("pt_jesdn_split_Total", pt_jesdn_split[0]);
-    j.addUserFloat("pt_jesup_split_Abs", pt_jesup_split[1]);
-    j.addUserFloat("pt_jesdn_split_Abs", pt_jesdn_split[1]);
-    j.addUserFloat("pt_jesup_split_Abs_year", pt_jesup_split[2]);
-    j.addUserFloat("pt_jesdn_split_Abs_year", pt_jesdn_split[2]);
-    j.addUserFloat("pt_jesup_split_BBEC1", pt_jesup_split[3]);
-    j.addUserFloat("pt_jesdn_split_BBEC1", pt_jesdn_split[3]);
-    j.addUserFloat("pt_jesup_split_BBEC1_year", pt_jesup_split[4]);
-    j.addUserFloat("pt_jesdn_split_BBEC1_year", pt_jesdn_split[4]);
-    j.addUserFloat("pt_jesup_split_EC2", pt_jesup_split[5]);
-    j.addUserFloat("pt_jesdn_split_EC2", pt_jesdn_split[5]);
-    j.addUserFloat("pt_jesup_split_EC2_year", pt_jesup_split[6]);
-    j.addUserFloat("pt_jesdn_split_EC2_year", pt_jesdn_split[6]);
-    j.addUserFloat("pt_jesup_split_FlavQCD", pt_jesup_split[7]);
-    j.addUserFloat("pt_jesdn_split_FlavQCD", pt_jesdn_split[7]);
-    j.addUserFloat("pt_jesup_split_HF", pt_jesup_split[8]);
-    j.addUserFloat("pt_jesdn_split_HF", pt_jesdn_split[8]);
-    j.addUserFloat("pt_jesup_split_HF_year", pt_jesup_split[9]);
-    j.addUserFloat("pt_jesdn_split_HF_year", pt_jesdn_split[9]);
-    j.addUserFloat("pt_jesup_split_RelBal", pt_jesup_split[10]);
-    j.addUserFloat("pt_jesdn_split_RelBal", pt_jesdn_split[10]);
-    j.addUserFloat("pt_jesup_split_RelSample_year", pt_jesup_split[11]);
-    j.addUserFloat("pt_jesdn_split_RelSample_year", pt_jesdn_split[11]);
+    // Single contributions to the total JEC uncertainty, and the corresponding pT UP/DN variations
+    JetShifts jesShifts;
+    for (unsigned s_unc = 0; s_unc < JetShifts::nSources; s_unc++){
+      jesShifts.unc[s_unc]  = jes_unc_split[s_unc];
+      jesShifts.ptUp[s_unc] = pt_jesup_split[s_unc];
+      jesShifts.ptDn[s_unc] = pt_jesdn_split[s_unc];
+    }
+    j.addUserData(JetShifts::label(), jesShifts);
     //////////////////////////////////////////////////////////////////////////////////////////////
       
     j.addUserFloat("pt_jerup", pt_jerup);
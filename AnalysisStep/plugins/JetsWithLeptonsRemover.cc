@@ -7,7 +7,7 @@
  */
 
 
-#include "FWCore/Framework/interface/EDProducer.h"
+#include "FWCore/Framework/interface/one/EDProducer.h"
 #include "FWCore/Framework/interface/Event.h"
 #include "FWCore/ParameterSet/interface/ParameterSet.h"
 #include "FWCore/Utilities/interface/InputTag.h"
@@ -26,6 +26,7 @@
 #include "CommonTools/Utils/interface/StringCutObjectSelector.h"
 #include <HTauTauHMuMu/AnalysisStep/interface/PhotonFwd.h>
 #include <HTauTauHMuMu/AnalysisStep/interface/DaughterDataHelpers.h>
+#include <HTauTauHMuMu/AnalysisStep/interface/EtaPhiGrid.h>
 
 #include "DataFormats/PatCandidates/interface/Jet.h"
 #include "DataFormats/Math/interface/Vector3D.h"
@@ -33,7 +34,7 @@
 #include <boost/foreach.hpp>
 #define foreach BOOST_FOREACH
 
-class  JetsWithLeptonsRemover: public edm::EDProducer {
+class  JetsWithLeptonsRemover: public edm::one::EDProducer<edm::one::SharedResources> {
 public:
   
   enum MatchingType{byConstituents, byDeltaR};
@@ -41,13 +42,29 @@ public:
   explicit JetsWithLeptonsRemover(const edm::ParameterSet & iConfig);
   virtual ~JetsWithLeptonsRemover() { }
 
-  virtual void produce(edm::Event & iEvent, const edm::EventSetup & iSetup);
-  bool checkLeptonJet(const edm::Event & event, const pat::Jet& jet);
-  bool isMatchingWithZZLeptons(const edm::Event & event, const pat::Jet& jet);
-  template <typename LEP>
-  bool isMatchingWith(const edm::EDGetTokenT<edm::View<LEP> >& token, const StringCutObjectSelector<LEP>& presel, const edm::Event & event, const pat::Jet& jet);
+  void produce(edm::Event & iEvent, const edm::EventSetup & iSetup) override;
 
 private:
+  /// Object a jet is cleaned against, in the order in which it is checked
+  struct CleaningObject {
+    enum Kind {
+      kVVLepton,    // lepton of the best diboson candidate, dR<0.4
+      kVVLeptonFSR, // FSR photon attached to it, dR<0.4
+      kVVFSR,       // FSR daughter of a Z, dR<0.05 and >50% of the jet energy
+      kLepton,      // preselected muon or electron, dR<0.4
+      kLeptonFSR    // FSR photon attached to it, dR<0.4
+    };
+    const reco::Candidate* cand;
+    double eta, phi;
+    Kind kind;
+  };
+
+  void collectZZLeptons(const edm::Event & event, std::vector<CleaningObject>& objs);
+  template <typename LEP>
+  void collectLeptons(const edm::EDGetTokenT<edm::View<LEP> >& token, const StringCutObjectSelector<LEP>& presel, const edm::Event & event, std::vector<CleaningObject>& objs);
+  void addObject(const reco::Candidate* cand, CleaningObject::Kind kind, std::vector<CleaningObject>& objs);
+  bool checkLeptonJet(const pat::Jet& jet, const std::vector<CleaningObject>& objs, const EtaPhiGrid& grid);
+
   /// Labels for input collections
   MatchingType matchingType_;
   edm::EDGetTokenT<edm::View<pat::Jet> > jetToken_;
@@ -111,6 +128,8 @@ JetsWithLeptonsRemover::JetsWithLeptonsRemover(const edm::ParameterSet & iConfig
   else cleaningFromDiboson_ = false;
 
   if(doDebugPlots_){
+    // The monitoring histograms are filled in produce(), so the module must hold the TFileService lock
+    usesResource(TFileService::kSharedResource);
     edm::Service<TFileService> fs;
     hNLeptonJets              = fs->make<TH1F>("hNLeptonJets"            , "Number of lepton-jets found",  10,   0, 10);
     hDeltaPt_jet_lepton       = fs->make<TH1F>("hDeltaPt_jet_lepton"     , "#Delta p_T (jet, l)"        , 100, -50, 50);
@@ -140,6 +159,17 @@ void JetsWithLeptonsRemover::produce(edm::Event & event, const edm::EventSetup &
   
 
   if(activateDebugPrintOuts_) std::cout << "\n\n----------- NEW EVENT ----------- number of jets: " << jets->size() << std::endl;
+
+  // Objects to clean against are the same for all jets: collect them once and index them in
+  // cells of the largest matching cone, so that each jet only looks at nearby objects
+  vector<CleaningObject> objs;
+  if(cleaningFromDiboson_) collectZZLeptons(event, objs);
+  collectLeptons<pat::Muon>    (muonToken_,     preselectionMu_,  event, objs);
+  collectLeptons<pat::Electron>(electronToken_, preselectionEle_, event, objs);
+
+  EtaPhiGrid grid(0.4);
+  grid.build(objs.size(), [&](size_t i) { return objs[i].eta; }, [&](size_t i) { return objs[i].phi; });
+
   int passPresel = 0;
   int numLepJets = 0;
   auto out = std::make_unique<vector<pat::Jet> >();
@@ -151,7 +181,7 @@ void JetsWithLeptonsRemover::produce(edm::Event & event, const edm::EventSetup &
       
     if(activateDebugPrintOuts_) std::cout<<"\n+++++ Jet +++++ pt: " << jet.pt() << " eta: " << jet.eta() << " phi: " << jet.phi() << std::endl;
     
-    if(checkLeptonJet(event, jet))
+    if(checkLeptonJet(jet, objs, grid))
       ++numLepJets;
     else
       out->push_back(jet);
@@ -166,97 +196,69 @@ void JetsWithLeptonsRemover::produce(edm::Event & event, const edm::EventSetup &
 }
 
 
-bool JetsWithLeptonsRemover::isMatchingWithZZLeptons(const edm::Event & event, const pat::Jet& jet) {
+void JetsWithLeptonsRemover::addObject(const reco::Candidate* cand, CleaningObject::Kind kind, std::vector<CleaningObject>& objs) {
+  CleaningObject o;
+  o.cand = cand;
+  o.eta  = cand->eta();
+  o.phi  = cand->phi();
+  o.kind = kind;
+  objs.push_back(o);
+}
+
+
+void JetsWithLeptonsRemover::collectZZLeptons(const edm::Event & event, std::vector<CleaningObject>& objs) {
 
   edm::Handle<edm::View<pat::CompositeCandidate> > VV; event.getByToken(diBosonToken_, VV);
-    pat::CompositeCandidate bestVV; bool found = false;
+    const pat::CompositeCandidate* bestVV = 0;
 
     // Search for the best ZZ pair that satisfy the preselection requirements
     foreach(const pat::CompositeCandidate &vv, *VV)
       if (preselectionVV_(vv)){
-	bestVV = vv; 
-	found = true;
+	bestVV = &vv; 
 	break;
       }
       
     
-    if(found) { 
+    if(bestVV) { 
       // loop over the Zs
       for(int i=0; i<2; ++i){
 	
-	const pat::CompositeCandidate *v =  dynamic_cast<const pat::CompositeCandidate*>(bestVV.daughter(i)->masterClone().get());
+	const pat::CompositeCandidate *v =  dynamic_cast<const pat::CompositeCandidate*>(bestVV->daughter(i)->masterClone().get());
 	
 	// loop over the leptons of each Z
 	for(int j=0; j<2; ++j){
-	  bool checkingVariable = false;
-	  if (matchingType_ == JetsWithLeptonsRemover::byDeltaR)
-	    checkingVariable = reco::deltaR(*v->daughter(j), jet) < 0.4;
-	  else
-	    std::cout << "Not making any matching, the matching you choose is not foreseen" << std::endl;
-	    
-	  
-	  if(checkingVariable){
-	    if(activateDebugPrintOuts_) std::cout << "\t\t !!! Found a matching lepton-jet (from VV candidate) !!!"<<std::endl;
-	    if(doDebugPlots_){
-	      hDeltaPt_jet_lepton     ->Fill(v->daughter(j)->pt()  - jet.pt());
-	      hDeltaPhi_jet_lepton    ->Fill(v->daughter(j)->phi() - jet.phi());
-	      hDeltaEta_jet_lepton    ->Fill(v->daughter(j)->eta() - jet.eta());  
-	    }
-	    return true;
-	  }
+	  if (matchingType_ != JetsWithLeptonsRemover::byDeltaR) continue;
+	  addObject(v->daughter(j), CleaningObject::kVVLepton, objs);
 	  
 	  if (cleanFSRFromLeptons_) {
 	    const PhotonPtrVector* gammas = userdatahelpers::getUserPhotons(&*v->daughter(j));
 	    if (gammas==0) continue;
 	    assert(gammas->size()<=1); // Must have already been preselected, so there should be at most 1 per l
-	    if (gammas->size()==1){
-	      const pat::PFParticle* fsr = gammas->begin()->get();
-	      if (matchingType_ == JetsWithLeptonsRemover::byDeltaR) {
-		checkingVariable = (reco::deltaR(*fsr, jet) < 0.4);
-	      }
-	      if(checkingVariable){
-		if(activateDebugPrintOuts_) {
-		  double photon_en_frac = fsr->energy()/jet.energy();
-		  std::cout << "\t\t !!! Found a matching FSR-jet !!! " <<  fsr->energy() << " " << jet.energy() << " " << photon_en_frac<<  std::endl;
-		}
-		return true;
-	      }
-	    }
+	    if (gammas->size()==1) addObject(gammas->begin()->get(), CleaningObject::kVVLeptonFSR, objs);
 	  }
 	}
 	
 	  
-	// Check if the jet matches FSR photons
+	// FSR photons of the Z
 	for (unsigned jfsr=2; jfsr<v->numberOfDaughters(); ++jfsr) {
-	  const pat::PFParticle* fsr = static_cast<const pat::PFParticle*>(v->daughter(jfsr));
-	  double photon_en_frac = v->daughter(jfsr)->energy()/jet.energy();
 	  if(activateDebugPrintOuts_) {
+	    const pat::PFParticle* fsr = static_cast<const pat::PFParticle*>(v->daughter(jfsr));
 	    int ilep = fsr->userFloat("leptIdx");
 	    std::cout << "Sister of " << ilep << " (" <<  fsr->pdgId() << "), pt: "
-		      << v->daughter(jfsr)->pt()   << " eta: " << v->daughter(jfsr)->eta() << " phi: " << fsr->phi() << " p: " << fsr->p()
-		      << " Photon energy fraction in the jet: " <<  photon_en_frac 
+		      << fsr->pt() << " eta: " << fsr->eta() << " phi: " << fsr->phi() << " p: " << fsr->p()
 		      << std::endl;
 	  }
-
-	  // If the FSR photon matches, reject the jet
-	  if(jet.photonMultiplicity() > 0 && photon_en_frac > 0.5 && reco::deltaR(*fsr, jet) < 0.05){
-	    if(activateDebugPrintOuts_) std::cout << "\t\t !!! Found a matching FSR lepton-jet (from VV candidate) !!!"<<std::endl;	  
-	    if(doDebugPlots_){
-	      hDeltaPt_jet_fsr     ->Fill(fsr->pt()  - jet.pt());
-	      hDeltaPhi_jet_fsr    ->Fill(fsr->phi() - jet.phi());
-	      hDeltaEta_jet_fsr    ->Fill(fsr->eta() - jet.eta());  
-	    }
-	    return true;
-	  }
+	  addObject(v->daughter(jfsr), CleaningObject::kVVFSR, objs);
 	}
       }
     }
-    return false;
 }
 
 
 template <typename LEP>
-bool JetsWithLeptonsRemover::isMatchingWith(const edm::EDGetTokenT<edm::View<LEP> >& token, const StringCutObjectSelector<LEP>& presel, const edm::Event & event, const pat::Jet& jet){
+void JetsWithLeptonsRemover::collectLeptons(const edm::EDGetTokenT<edm::View<LEP> >& token, const StringCutObjectSelector<LEP>& presel, const edm::Event & event, std::vector<CleaningObject>& objs){
+
+  if (matchingType_ != JetsWithLeptonsRemover::byDeltaR) return;
 
   // Check for muon-originated jets   
   edm::Handle<edm::View<LEP> > leptons; event.getByToken(token, leptons);
@@ -267,50 +269,67 @@ bool JetsWithLeptonsRemover::isMatchingWith(const edm::EDGetTokenT<edm::View<LEP
     
     if(activateDebugPrintOuts_) std::cout<<"Lepton pt: " << lepton.pt()   << " eta: " << lepton.eta()    << " phi: " << lepton.phi() << " p: " << lepton.p() << std::endl;  
       
-    bool checkingVariable = false;
-    if (matchingType_ == JetsWithLeptonsRemover::byDeltaR)
-      checkingVariable = reco::deltaR(lepton, jet) < 0.4;
-    else
-      std::cout << "Not making any matching, the matching you choose is not foreseen" << std::endl;
-    
-    if(checkingVariable){
-      if(activateDebugPrintOuts_) std::cout << "\t\t !!! Found a matching lepton-jet !!!"<<std::endl;
-      return true;
-    }
+    addObject(&lepton, CleaningObject::kLepton, objs);
 
     if (cleanFSRFromLeptons_) {
       const PhotonPtrVector* gammas = userdatahelpers::getUserPhotons(&lepton);
       if (gammas==0) continue;
       assert(gammas->size()<=1); // Must have already been preselected, so there should be at most 1 per l
-      if (gammas->size()==1){
-	const pat::PFParticle* fsr = gammas->begin()->get();
-	if (matchingType_ == JetsWithLeptonsRemover::byDeltaR) {
-	  checkingVariable = (reco::deltaR(*fsr, jet) < 0.4);
-	}
-	if(checkingVariable){
-	  if(activateDebugPrintOuts_) {
-	    double photon_en_frac = fsr->energy()/jet.energy();
-	    std::cout << "\t\t !!! Found a matching FSR-jet !!! " <<  fsr->energy() << " " << jet.energy() << " " << photon_en_frac<<  std::endl;
-	  }
-	  return true;
-	}
-      }
+      if (gammas->size()==1) addObject(gammas->begin()->get(), CleaningObject::kLeptonFSR, objs);
     }
-
-
   }
-  return false;
 }
 
 
-bool JetsWithLeptonsRemover::checkLeptonJet(const edm::Event & event, const pat::Jet& jet){
-
-  if(cleaningFromDiboson_ && isMatchingWithZZLeptons(event,jet)) return true;
-  
-  if(isMatchingWith<pat::Muon>    (muonToken_,     preselectionMu_,  event, jet) || 
-     isMatchingWith<pat::Electron>(electronToken_, preselectionEle_, event, jet)) return true;
-  
-  return false;
+bool JetsWithLeptonsRemover::checkLeptonJet(const pat::Jet& jet, const std::vector<CleaningObject>& objs, const EtaPhiGrid& grid){
+
+  const double jetEta = jet.eta(), jetPhi = jet.phi();
+
+  // The first matching object in checking order decides (and is the one reported)
+  unsigned first = objs.size();
+  grid.forEachNear(jetEta, jetPhi, [&](unsigned i) {
+      if (i >= first) return;
+      const CleaningObject& o = objs[i];
+      double dR2 = reco::deltaR2(o.eta, o.phi, jetEta, jetPhi);
+      bool match;
+      if (o.kind == CleaningObject::kVVFSR)
+	match = jet.photonMultiplicity() > 0 && o.cand->energy()/jet.energy() > 0.5 && dR2 < 0.05*0.05;
+      else
+	match = dR2 < 0.4*0.4;
+      if (match) first = i;
+    });
+  if (first == objs.size()) return false;
+
+  const CleaningObject& o = objs[first];
+  switch (o.kind) {
+  case CleaningObject::kVVLepton:
+    if(activateDebugPrintOuts_) std::cout << "\t\t !!! Found a matching lepton-jet (from VV candidate) !!!"<<std::endl;
+    if(doDebugPlots_){
+      hDeltaPt_jet_lepton     ->Fill(o.cand->pt()  - jet.pt());
+      hDeltaPhi_jet_lepton    ->Fill(o.cand->phi() - jet.phi());
+      hDeltaEta_jet_lepton    ->Fill(o.cand->eta() - jet.eta());  
+    }
+    break;
+  case CleaningObject::kVVFSR:
+    if(activateDebugPrintOuts_) std::cout << "\t\t !!! Found a matching FSR lepton-jet (from VV candidate) !!!"<<std::endl;	  
+    if(doDebugPlots_){
+      hDeltaPt_jet_fsr     ->Fill(o.cand->pt()  - jet.pt());
+      hDeltaPhi_jet_fsr    ->Fill(o.cand->phi() - jet.phi());
+      hDeltaEta_jet_fsr    ->Fill(o.cand->eta() - jet.eta());  
+    }
+    break;
+  case CleaningObject::kLepton:
+    if(activateDebugPrintOuts_) std::cout << "\t\t !!! Found a matching lepton-jet !!!"<<std::endl;
+    break;
+  case CleaningObject::kVVLeptonFSR:
+  case CleaningObject::kLeptonFSR:
+    if(activateDebugPrintOuts_) {
+      double photon_en_frac = o.cand->energy()/jet.energy();
+      std::cout << "\t\t !!! Found a matching FSR-jet !!! " <<  o.cand->energy() << " " << jet.energy() << " " << photon_en_frac<<  std::endl;
+    }
+    break;
+  }
+  return true;
 }
 
 
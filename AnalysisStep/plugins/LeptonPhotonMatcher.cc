@@ -9,7 +9,7 @@
  */
 
 #include <FWCore/Framework/interface/Frameworkfwd.h>
-#include <FWCore/Framework/interface/EDProducer.h>
+#include <FWCore/Framework/interface/stream/EDProducer.h>
 #include <FWCore/Framework/interface/Event.h>
 #include <FWCore/ParameterSet/interface/ParameterSet.h>
 #include <FWCore/Framework/interface/ESHandle.h>
@@ -25,6 +25,7 @@
 #include <HTauTauHMuMu/AnalysisStep/interface/LeptonIsoHelper.h>
 
 #include <HTauTauHMuMu/AnalysisStep/interface/CutSet.h>
+#include <HTauTauHMuMu/AnalysisStep/interface/EtaPhiGrid.h>
 
 #include <HTauTauHMuMu/AnalysisStep/interface/MCHistoryTools.h>
 #include <Math/VectorUtil.h>
@@ -32,6 +33,8 @@
 
 #include <vector>
 #include <string>
+#include <algorithm>
+#include <memory>
 
 
 
@@ -39,7 +42,7 @@ using namespace edm;
 using namespace std;
 using namespace reco;
 
-class LeptonPhotonMatcher : public edm::EDProducer {
+class LeptonPhotonMatcher : public edm::stream::EDProducer<> {
  public:
   /// Constructor
   explicit LeptonPhotonMatcher(const edm::ParameterSet&);
@@ -48,9 +51,7 @@ class LeptonPhotonMatcher : public edm::EDProducer {
   ~LeptonPhotonMatcher(){};  
 
  private:
-  virtual void beginJob(){};  
-  virtual void produce(edm::Event&, const edm::EventSetup&);
-  virtual void endJob(){};
+  void produce(edm::Event&, const edm::EventSetup&) override;
   PhotonPtr selectFSR(const PhotonPtrVector& photons, const reco::LeafCandidate::Vector& lepMomentum);
 
   edm::EDGetTokenT<pat::MuonCollection> muonToken;
@@ -162,11 +163,34 @@ LeptonPhotonMatcher::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
   auto resultLooseEle = std::make_unique<pat::ElectronCollection>();
   auto resultTle = std::make_unique<pat::PhotonCollection>();
 
-  // Associate a vector of Ptr<Photon> to lepton pointers
-  typedef map<const reco::Candidate*, PhotonPtrVector> PhotonLepMap;
-  PhotonLepMap theMap;
+  // Leptons that can be associated to photons: muons, electrons and loose electrons, in this order.
+  // fsrOfLep[k] collects the photons for which lepton k is the closest one.
+  const unsigned nMu = muonHandle->size(), nEle = electronHandle->size();
+  const unsigned nLooseEle = do_RSE ? looseElectronHandle->size() : 0;
+  vector<const reco::Candidate*> leps;
+  leps.reserve(nMu+nEle+nLooseEle);
+  for (unsigned j=0; j<nMu; ++j) leps.push_back(&(*muonHandle)[j]);
+  for (unsigned j=0; j<nEle; ++j) leps.push_back(&(*electronHandle)[j]);
+  for (unsigned j=0; j<nLooseEle; ++j) leps.push_back(&(*looseElectronHandle)[j]);
+  vector<PhotonPtrVector> fsrOfLep(leps.size());
 
   if (selectionMode!=0 && muonHandle->size()+electronHandle->size()>0) {
+    // Index the candidate leptons in cells wider than the dR<0.5 association cone, so that
+    // each photon only looks at the leptons in its own and neighbouring cells
+    vector<unsigned> candLeps; // those satisfying loose ID + SIP
+    for (unsigned j=0; j<nMu; ++j) if ((*muonHandle)[j].userFloat("isSIP")) candLeps.push_back(j);
+    for (unsigned j=0; j<nEle; ++j) if ((*electronHandle)[j].userFloat("isSIP")) candLeps.push_back(nMu+j);
+    if (do_FSR_for_RSE) {
+      for (unsigned j=0; j<nLooseEle; ++j) if ((*looseElectronHandle)[j].userFloat("isSIP")) candLeps.push_back(nMu+nEle+j);
+    }
+    EtaPhiGrid lepGrid(0.55);
+    lepGrid.build(candLeps.size(),
+                  [&](size_t i) { return leps[candLeps[i]]->eta(); },
+                  [&](size_t i) { return leps[candLeps[i]]->phi(); });
+
+    // Index of the PF candidates for the photon isolation, built when first needed
+    std::unique_ptr<PFCandidateIndex> pfIndex;
+
     //----------------------
     // Loop on photons
     //----------------------
@@ -176,63 +200,29 @@ LeptonPhotonMatcher::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
       PhotonPtr g = photonHandle->ptrAt(i);
 
       //------------------------------------------------------
-      // Get the closest lepton among those satisfying loose ID + SIP
+      // Get the closest lepton among those satisfying loose ID + SIP.
+      // Muons are considered only for photons in the muon eta range (|eta|<2.4), electrons
+      // up to |eta|<2.5; on equal dR the lepton coming first in leps is kept.
       //------------------------------------------------------
       double dRMin(10e9);
-      const reco::Candidate* closestLep = 0;
-
-      //---------------------
-      // Loop over pat::Muon. We consider only photons in the muon eta range (|eta|<2.4)
-      //---------------------
-      if (fabs(g->eta())<2.4) {
-        for (unsigned int j = 0; j< muonHandle->size(); ++j){
-          //      const pat::Muon* m = ((*muonHandle)[j]).get();
-          const pat::Muon* m = &((*muonHandle)[j]);
-          if (! m->userFloat("isSIP")) continue;
-          double dR = ROOT::Math::VectorUtil::DeltaR(m->momentum(),g->momentum());
-          if(debug) cout << "muon pt = " << m->pt() << " photon pt = " << g->pt() << " dR = " << dR << endl;
-          if (dR>0.5) continue;
-          if (dR<dRMin) {
+      int closest = -1;
+      const bool muonRange = fabs(g->eta())<2.4;
+      lepGrid.forEachNear(g->eta(), g->phi(), [&](unsigned c) {
+          unsigned k = candLeps[c];
+          if (k<nMu && !muonRange) return;
+          const reco::Candidate* l = leps[k];
+          double dR = ROOT::Math::VectorUtil::DeltaR(l->momentum(),g->momentum());
+          if(debug) cout << (k<nMu ? "muon" : "ele") << " pt = " << l->pt() << " photon pt = " << g->pt() << " dR = " << dR << endl;
+          if (dR>0.5) return;
+          if (dR<dRMin || (dR==dRMin && int(k)<closest)) {
             dRMin = dR;
-            closestLep = m;
+            closest = k;
           }
-        }//end loop over muon collection
-      }
-
-      //---------------------
-      // Loop over pat::Electron. keeping all preselected photons up to |eta|<2.5
-      //---------------------
-      for (unsigned int j = 0; j< electronHandle->size(); ++j){
-        //      const pat::Electron* e = ((*electronHandle)[j]).get();
-        const pat::Electron* e = &((*electronHandle)[j]);
-        if ( ! e->userFloat("isSIP")) continue;
-        double dR = ROOT::Math::VectorUtil::DeltaR(e->momentum(),g->momentum());
-        if(debug) cout << "ele pt = " << e->pt() << " photon pt = " << g->pt() << " dR = " << dR << endl;
-        if (dR>0.5) continue;
-        if (dR<dRMin) {
-          dRMin = dR;
-          closestLep = e;
-        }
-      }//end loop over electron collection
-
-      //---------------------
-      // Loop over loose pat::Electron
-      //---------------------
-      if(do_RSE && do_FSR_for_RSE) {
-        for (unsigned int j = 0; j< electronHandle->size(); ++j){
-              const pat::Electron* e = &((*looseElectronHandle)[j]);
-              if ( ! e->userFloat("isSIP")) continue;
-              double dR = ROOT::Math::VectorUtil::DeltaR(e->momentum(),g->momentum());
-              if (dR>0.5) continue;
-              if (dR<dRMin) {
-                dRMin = dR;
-                closestLep = e;
-              }
-        }//end loop over loose electron collection
-      }
+        });
 
       // Add photon to the vector that will be attached as userData for the corresponding lepton 
-      if(closestLep!=0) {
+      if(closest>=0) {
+        const reco::Candidate* closestLep = leps[closest];
         // Now that we know the closest lepton, apply Photon Selection
         bool accept = false;
         double gRelIso = 999., neu(999.), chg(999.), chgByWorstPV(999.);
@@ -243,7 +233,8 @@ LeptonPhotonMatcher::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
 
         } else if (selectionMode==3) { // RunII
           if (dRMin<0.5 && g->pt()>2. && dRMin/pT/pT<0.012) {
-            LeptonIsoHelper::fsrIso(&(*g), pfCands, neu, chg, chgByWorstPV);
+            if (!pfIndex) pfIndex = std::make_unique<PFCandidateIndex>(*pfCands, 0.3);
+            LeptonIsoHelper::fsrIso(&(*g), *pfIndex, neu, chg, chgByWorstPV);
             gRelIso = (neu + chg)/pT;
             if (gRelIso<1.8) accept = true;
           }
@@ -251,76 +242,50 @@ LeptonPhotonMatcher::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
 
         if(debug) cout << "LPMatcher: gamma pT: " << g->pt() << " closest lep: " << closestLep->pdgId() << " " << closestLep->pt() <<  " gRelIso: " << gRelIso << " (ch: " << chg << " n+p: " <<  neu << ")  dR: " << dRMin << " dR/ET2: " << dRMin/g->pt()/g->pt() << " accept: " << accept << endl;
 
-        if (accept) theMap[closestLep].push_back(g);
+        if (accept) fsrOfLep[closest].push_back(g);
       }
     } // end of loop over photon collection
   }
-  
-  // Loop over muons again to write the result as userData
+
+  // Attach the photons associated to lepton k as userData
   PhotonPtrVector allSelFSR;
-  for (unsigned int j = 0; j< muonHandle->size(); ++j){
-    //    const pat::Muon* m = ((*muonHandle)[j]).get(); // Pointer to original mu
-    const pat::Muon* m = &((*muonHandle)[j]);
-    //---Clone the pat::Muon
-    pat::Muon newM(*m);
-    if (selectionMode!=0) {
-      PhotonLepMap::const_iterator fsr = theMap.find(m);
-      if (fsr!=theMap.end()) {
-        if (selectionMode==3) { // Run II: select one per lepton; highest-pT if >4GeV, lowest-DR otherwise
-          PhotonPtr g = selectFSR(fsr->second,m->momentum());
-          PhotonPtrVector gv = {g};       
-          newM.addUserData("FSRCandidates",gv);
-          allSelFSR.push_back(g);
-        } else { //Legacy, etc.: keep all
-          newM.addUserData("FSRCandidates",fsr->second);
-        }
-      }
+  auto attachFSR = [&](unsigned k, auto& newLep) {
+    const PhotonPtrVector& photons = fsrOfLep[k];
+    if (photons.empty()) return;
+    PhotonPtrVector gv;
+    if (selectionMode==3) { // Run II: select one per lepton; highest-pT if >4GeV, lowest-DR otherwise
+      gv = {selectFSR(photons,leps[k]->momentum())};
+      allSelFSR.push_back(gv.front());
+    } else { //Legacy, etc.: keep all
+      gv = photons;
     }
+    newLep.addUserData("FSRCandidates",gv);
+  };
+
+  // Loop over muons again to write the result as userData
+  for (unsigned int j = 0; j< nMu; ++j){
+    //---Clone the pat::Muon
+    pat::Muon newM((*muonHandle)[j]);
+    if (selectionMode!=0) attachFSR(j, newM);
     resultMu->push_back(newM);
   }
 
 
   if(do_RSE) {
     //Loop over electrons again to write the result as userData
-    for(unsigned int j = 0; j < looseElectronHandle->size(); ++j) {
-      const pat::Electron* e = &((*looseElectronHandle)[j]);
+    for(unsigned int j = 0; j < nLooseEle; ++j) {
       //---Clone the pat::Electron
-      pat::Electron newE(*e);
-      if (selectionMode != 0 && do_FSR_for_RSE) {
-        PhotonLepMap::const_iterator fsr = theMap.find(e);
-        if (fsr!=theMap.end()) {
-          if (selectionMode == 3) { // Run II: select one per lepton; highest-pT if >4GeV, lowest-DR otherwise
-            PhotonPtr g = selectFSR(fsr->second,e->momentum());
-            PhotonPtrVector gv = {g};     
-            newE.addUserData("FSRCandidates",gv);
-            allSelFSR.push_back(g);
-          } else { //Legacy, etc.: keep all
-            newE.addUserData("FSRCandidates",fsr->second);
-          }
-        }
-      }
+      pat::Electron newE((*looseElectronHandle)[j]);
+      if (selectionMode != 0 && do_FSR_for_RSE) attachFSR(nMu+nEle+j, newE);
       resultLooseEle->push_back(newE);
     }
   }
 
   //Loop over electrons again to write the result as userData
-  for (unsigned int j = 0; j< electronHandle->size(); ++j){
-    const pat::Electron* e = &((*electronHandle)[j]);
+  for (unsigned int j = 0; j< nEle; ++j){
     //---Clone the pat::Electron
-    pat::Electron newE(*e);
-    if (selectionMode!=0) {
-      PhotonLepMap::const_iterator fsr = theMap.find(e);
-      if (fsr!=theMap.end()) {
-        if (selectionMode==3) { // Run II: select one per lepton; highest-pT if >4GeV, lowest-DR otherwise
-          PhotonPtr g = selectFSR(fsr->second,e->momentum());
-          PhotonPtrVector gv = {g};       
-          newE.addUserData("FSRCandidates",gv);
-          allSelFSR.push_back(g);
-        } else { //Legacy, etc.: keep all
-          newE.addUserData("FSRCandidates",fsr->second);
-        }
-      }
-    }
+    pat::Electron newE((*electronHandle)[j]);
+    if (selectionMode!=0) attachFSR(nMu+j, newE);
     resultEle->push_back(newE);
   }
 
@@ -359,16 +324,30 @@ LeptonPhotonMatcher::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
       rhoForEle = *rhoHandle;
     }
 
-    for (pat::MuonCollection::iterator m= resultMu->begin(); m!=resultMu->end(); ++m){
+    // Index the selected FSR photons in cells wider than the largest isolation cone (0.4)
+    EtaPhiGrid fsrGrid(0.45);
+    fsrGrid.build(allSelFSR.size(),
+                  [&](size_t i) { return allSelFSR[i]->eta(); },
+                  [&](size_t i) { return allSelFSR[i]->phi(); });
+
+    // Sum of the pT of the selected FSR photons for which inCone(dR) holds, summed in allSelFSR order
+    vector<unsigned> near; // scratch, reused for all leptons
+    auto fsrCorrection = [&](const reco::Candidate& lep, auto inCone) {
+      near.clear();
+      fsrGrid.forEachNear(lep.eta(), lep.phi(), [&](unsigned i) { near.push_back(i); });
+      std::sort(near.begin(), near.end());
       float fsrCorr = 0; // The correction to PFPhotonIso
-      for (PhotonPtrVector::const_iterator g = allSelFSR.begin();g!= allSelFSR.end(); ++g) {
-        const pat::PFParticle* gamma = g->get();
-        double dR = ROOT::Math::VectorUtil::DeltaR(gamma->momentum(),m->momentum());
-        // Check if the photon is in the lepton's iso cone and not vetoed
-        if (dR<0.4 && dR > 0.01) {
-          fsrCorr += gamma->pt();
-        }
-      } 
+      for (unsigned i : near) {
+        const pat::PFParticle* gamma = allSelFSR[i].get();
+        double dR = ROOT::Math::VectorUtil::DeltaR(gamma->momentum(),lep.momentum());
+        if (inCone(dR)) fsrCorr += gamma->pt();
+      }
+      return fsrCorr;
+    };
+
+    for (pat::MuonCollection::iterator m= resultMu->begin(); m!=resultMu->end(); ++m){
+      // Photons in the lepton's iso cone and not vetoed
+      float fsrCorr = fsrCorrection(*m, [](double dR) { return dR<0.4 && dR > 0.01; });
       float combRelIsoPFCorr =  LeptonIsoHelper::combRelIsoPF(sampleType, setup, rhoForMu, *m, fsrCorr);
       m->addUserFloat("combRelIsoPFFSRCorr", combRelIsoPFCorr);
       m->addUserFloat("passLooseCombRelIsoPFFSRCorr",combRelIsoPFCorr < 0.5);
@@ -376,15 +355,9 @@ LeptonPhotonMatcher::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
     }
 
     for (pat::ElectronCollection::iterator e= resultEle->begin(); e!=resultEle->end(); ++e){
-      float fsrCorr = 0; // The correction to PFPhotonIso
-      for (PhotonPtrVector::const_iterator g = allSelFSR.begin();g!= allSelFSR.end(); ++g) {
-        const pat::PFParticle* gamma = g->get();
-        double dR = ROOT::Math::VectorUtil::DeltaR(gamma->momentum(),e->momentum());
-        // Check if the photon is in the lepton's iso cone and not vetoed
-        if (dR<0.3 && (fabs(e->superCluster()->eta()) < 1.479 || dR > 0.08)) {
-          fsrCorr += gamma->pt();
-        }
-      }
+      // Photons in the lepton's iso cone and not vetoed
+      bool barrel = fabs(e->superCluster()->eta()) < 1.479;
+      float fsrCorr = fsrCorrection(*e, [barrel](double dR) { return dR<0.3 && (barrel || dR > 0.08); });
       float combRelIsoPFCorr =  LeptonIsoHelper::combRelIsoPF(sampleType, setup, rhoForEle, *e, fsrCorr);
       e->addUserFloat("combRelIsoPFFSRCorr", combRelIsoPFCorr);
       e->addUserFloat("passLooseCombRelIsoPFFSRCorr",combRelIsoPFCorr < 0.5);
@@ -413,16 +386,9 @@ LeptonPhotonMatcher::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
     
     if(do_RSE) {
       for (pat::ElectronCollection::iterator e= resultLooseEle->begin(); e != resultLooseEle->end(); ++e){
-        float fsrCorr = 0; // The correction to PFPhotonIso
-        
-        for (PhotonPtrVector::const_iterator g = allSelFSR.begin();g!= allSelFSR.end(); ++g) {
-              const pat::PFParticle* gamma = g->get();
-              double dR = ROOT::Math::VectorUtil::DeltaR(gamma->momentum(),e->momentum());
-              // Check if the photon is in the lepton's iso cone and not vetoed
-              if (dR<0.3 && (fabs(e->superCluster()->eta()) < 1.479 || dR > 0.08)) {
-                  fsrCorr += gamma->pt();
-              }
-        }
+        // Photons in the lepton's iso cone and not vetoed
+        bool barrel = fabs(e->superCluster()->eta()) < 1.479;
+        float fsrCorr = fsrCorrection(*e, [barrel](double dR) { return dR<0.3 && (barrel || dR > 0.08); });
         float combRelIsoPFCorr = LeptonIsoHelper::combRelIsoPF(sampleType, setup, rhoForEle, *e, fsrCorr);
         e->addUserFloat("combRelIsoPFFSRCorr", combRelIsoPFCorr);
         e->addUserFloat("passLooseCombRelIsoPFFSRCorr",combRelIsoPFCorr < 0.5);
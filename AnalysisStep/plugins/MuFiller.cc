@@ -11,12 +11,13 @@
  */
 
 #include <FWCore/Framework/interface/Frameworkfwd.h>
-#include <FWCore/Framework/interface/EDProducer.h>
+#include <FWCore/Framework/interface/stream/EDProducer.h>
 #include <FWCore/Framework/interface/Event.h>
 #include <FWCore/ParameterSet/interface/ParameterSet.h>
 #include <FWCore/Framework/interface/ESHandle.h>
 
 #include <DataFormats/PatCandidates/interface/Muon.h>
+#include <DataFormats/MuonReco/interface/MuonSelectors.h>
 #include "DataFormats/VertexReco/interface/Vertex.h"
 // #include <DataFormats/Common/interface/TriggerResults.h>
 #include "DataFormats/Math/interface/deltaR.h"
@@ -24,7 +25,6 @@
 #include <HTauTauHMuMu/AnalysisStep/interface/CutSet.h>
 #include <HTauTauHMuMu/AnalysisStep/interface/LeptonIsoHelper.h>
 
-#include "MuonMVAReader/Reader/interface/MuonGBRForestReader.hpp"
 
 #include <vector>
 #include <string>
@@ -34,7 +34,7 @@ using namespace std;
 using namespace reco;
 
 
-class MuFiller : public edm::EDProducer {
+class MuFiller : public edm::stream::EDProducer<> {
    public:
    /// Constructor
    explicit MuFiller(const edm::ParameterSet&);
@@ -43,24 +43,19 @@ class MuFiller : public edm::EDProducer {
    ~MuFiller();
    
    private:
-   virtual void beginJob(){};
-   virtual void produce(edm::Event&, const edm::EventSetup&);
-   virtual void endJob(){};
+   void produce(edm::Event&, const edm::EventSetup&) override;
    
    edm::EDGetTokenT<pat::MuonRefVector> muonToken;
    //edm::EDGetTokenT<vector<pat::Muon> > muonToken;
 
    int sampleType;
    int setup;
-   const StringCutObjectSelector<pat::Muon, true> cut;
+   const CompiledCut<pat::Muon> cut;
    // const edm::EDGetTokenT<pat::TriggerObjectStandAloneCollection> triggerObjects_;
    // const edm::EDGetTokenT< edm::TriggerResults > triggerResultsToken_;
    const CutSet<pat::Muon> flags;
    edm::EDGetTokenT<double> rhoToken;
    edm::EDGetTokenT<vector<Vertex> > vtxToken;
-   
-   // MVA Reader
-   MuonGBRForestReader *r;
 };
 
 
@@ -77,13 +72,10 @@ flags(iConfig.getParameter<edm::ParameterSet>("flags"))
    rhoToken = consumes<double>(LeptonIsoHelper::getMuRhoTag(sampleType, setup));
    vtxToken = consumes<vector<Vertex> >(edm::InputTag("goodPrimaryVertices"));
    produces<pat::MuonCollection>();
-   
-   // MVA Reader
-   r = new MuonGBRForestReader(setup, 2);
-	
 }
 
-MuFiller::~MuFiller(){}
+MuFiller::~MuFiller(){
+}
 
 
 void
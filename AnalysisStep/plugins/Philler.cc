@@ -5,7 +5,7 @@
  */
 
 #include <FWCore/Framework/interface/Frameworkfwd.h>
-#include <FWCore/Framework/interface/EDProducer.h>
+#include <FWCore/Framework/interface/global/EDProducer.h>
 #include <FWCore/Framework/interface/Event.h>
 #include <FWCore/ParameterSet/interface/ParameterSet.h>
 #include <FWCore/Framework/interface/ESHandle.h>
@@ -28,7 +28,7 @@ using namespace reco;
 
 
 
-class Philler : public edm::EDProducer {
+class Philler : public edm::global::EDProducer<> {
  public:
   /// Constructor
   explicit Philler(const edm::ParameterSet&);
@@ -38,9 +38,7 @@ class Philler : public edm::EDProducer {
   };  
 
  private:
-  virtual void beginJob(){};  
-  virtual void produce(edm::Event&, const edm::EventSetup&);
-  virtual void endJob(){};
+  void produce(edm::StreamID, edm::Event&, const edm::EventSetup&) const override;
 
   edm::EDGetTokenT<edm::View<reco::Photon>> photonToken;
   edm::EDGetTokenT<pat::ElectronCollection> electronToken;
@@ -78,7 +76,7 @@ Philler::Philler(const edm::ParameterSet& iConfig) :
 
 
 void
-Philler::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
+Philler::produce(edm::StreamID, edm::Event& iEvent, const edm::EventSetup& iSetup) const
 {
 
   edm::Handle<edm::View<reco::Photon>> photonHandle;
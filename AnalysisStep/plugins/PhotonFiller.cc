@@ -13,7 +13,7 @@
  */
 
 #include <FWCore/Framework/interface/Frameworkfwd.h>
-#include <FWCore/Framework/interface/EDProducer.h>
+#include <FWCore/Framework/interface/global/EDProducer.h>
 #include <FWCore/Framework/interface/Event.h>
 #include <FWCore/ParameterSet/interface/ParameterSet.h>
 #include <FWCore/Framework/interface/ESHandle.h>
@@ -40,7 +40,7 @@ using namespace edm;
 using namespace std;
 using namespace reco;
 
-class PhotonFiller : public edm::EDProducer {
+class PhotonFiller : public edm::global::EDProducer<> {
  public:
   /// Constructor
   explicit PhotonFiller(const edm::ParameterSet&);
@@ -49,9 +49,7 @@ class PhotonFiller : public edm::EDProducer {
   ~PhotonFiller(){};  
 
  private:
-  virtual void beginJob(){};  
-  virtual void produce(edm::Event&, const edm::EventSetup&);
-  virtual void endJob(){};
+  void produce(edm::StreamID, edm::Event&, const edm::EventSetup&) const override;
 
   edm::EDGetTokenT<pat::ElectronCollection> electronToken;
   edm::EDGetTokenT<edm::View<pat::PackedCandidate> > pfCandToken;
@@ -86,7 +84,7 @@ PhotonFiller::PhotonFiller(const edm::ParameterSet& iConfig) :
 
 
 void
-PhotonFiller::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
+PhotonFiller::produce(edm::StreamID, edm::Event& iEvent, const edm::EventSetup& iSetup) const
 {
 
   //  edm::Handle<pat::ElectronRefVector> electronHandle;
@@ -0,0 +1,132 @@
+/** \class PreSkimFilter
+ *
+ *  Fast event pre-selection, run before the lepton and candidate building.
+ *  An event passes if any of the configured channels does: one of the HLT
+ *  paths of the channel fired (no requirement if none is given) and the
+ *  slimmed muon, electron and tau collections contain the required number
+ *  of objects above the pT thresholds. The thresholds must be looser than
+ *  the downstream lepton selection, so that only events that cannot give a
+ *  selected candidate are rejected.
+ */
+
+#include <FWCore/Framework/interface/Frameworkfwd.h>
+#include <FWCore/Framework/interface/stream/EDFilter.h>
+#include <FWCore/Framework/interface/Event.h>
+#include <FWCore/ParameterSet/interface/ParameterSet.h>
+#include <FWCore/Utilities/interface/InputTag.h>
+#include <FWCore/Utilities/interface/RegexMatch.h>
+#include <FWCore/Common/interface/TriggerNames.h>
+#include <DataFormats/Common/interface/TriggerResults.h>
+#include <DataFormats/Candidate/interface/Candidate.h>
+
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace edm;
+
+class PreSkimFilter : public edm::stream::EDFilter<> {
+public:
+  /// Constructor
+  explicit PreSkimFilter(const edm::ParameterSet&);
+
+  /// Destructor
+  ~PreSkimFilter() {}
+
+private:
+  bool filter(edm::Event&, const edm::EventSetup&) override;
+
+  unsigned countAbove(const edm::View<reco::Candidate>& cands, double ptMin) const;
+
+  struct Channel {
+    std::vector<std::string> triggers; // HLT path names, wildcards allowed
+    std::vector<unsigned> triggerBits; // their positions in the TriggerResults of the current menu
+    unsigned nMuons;
+    unsigned nElectrons;
+    unsigned nTaus;
+  };
+
+  edm::EDGetTokenT<edm::TriggerResults> triggerResultsToken;
+  edm::EDGetTokenT<edm::View<reco::Candidate> > muonToken;
+  edm::EDGetTokenT<edm::View<reco::Candidate> > electronToken;
+  edm::EDGetTokenT<edm::View<reco::Candidate> > tauToken;
+  const double muonPtMin;
+  const double electronPtMin;
+  const double tauPtMin;
+  std::vector<Channel> channels;
+
+  edm::ParameterSetID triggerNamesID; // menu the triggerBits refer to
+};
+
+
+PreSkimFilter::PreSkimFilter(const edm::ParameterSet& iConfig) :
+  triggerResultsToken(consumes<edm::TriggerResults>(iConfig.getParameter<edm::InputTag>("triggerResults"))),
+  muonToken(consumes<edm::View<reco::Candidate> >(iConfig.getParameter<edm::InputTag>("muons"))),
+  electronToken(consumes<edm::View<reco::Candidate> >(iConfig.getParameter<edm::InputTag>("electrons"))),
+  tauToken(consumes<edm::View<reco::Candidate> >(iConfig.getParameter<edm::InputTag>("taus"))),
+  muonPtMin(iConfig.getParameter<double>("muonPtMin")),
+  electronPtMin(iConfig.getParameter<double>("electronPtMin")),
+  tauPtMin(iConfig.getParameter<double>("tauPtMin"))
+{
+  for (const edm::ParameterSet& ps : iConfig.getParameter<std::vector<edm::ParameterSet> >("channels")) {
+    Channel ch;
+    ch.triggers   = ps.getParameter<std::vector<std::string> >("triggers");
+    ch.nMuons     = ps.getParameter<unsigned>("nMuons");
+    ch.nElectrons = ps.getParameter<unsigned>("nElectrons");
+    ch.nTaus      = ps.getParameter<unsigned>("nTaus");
+    channels.push_back(ch);
+  }
+}
+
+
+unsigned PreSkimFilter::countAbove(const edm::View<reco::Candidate>& cands, double ptMin) const
+{
+  unsigned n = 0;
+  for (const reco::Candidate& c : cands) if (c.pt() > ptMin) ++n;
+  return n;
+}
+
+
+bool PreSkimFilter::filter(edm::Event& iEvent, const edm::EventSetup&)
+{
+  Handle<edm::TriggerResults> triggerResults;
+  iEvent.getByToken(triggerResultsToken, triggerResults);
+
+  // Resolve the path names only when the menu changes
+  if (triggerResults->parameterSetID() != triggerNamesID) {
+    triggerNamesID = triggerResults->parameterSetID();
+    const std::vector<std::string>& names = iEvent.triggerNames(*triggerResults).triggerNames();
+    for (Channel& ch : channels) {
+      ch.triggerBits.clear();
+      for (const std::string& pattern : ch.triggers) {
+        for (std::vector<std::string>::const_iterator match : edm::regexMatch(names, pattern)) {
+          ch.triggerBits.push_back(match - names.begin());
+        }
+      }
+    }
+  }
+
+  Handle<View<reco::Candidate> > muons;
+  iEvent.getByToken(muonToken, muons);
+  Handle<View<reco::Candidate> > electrons;
+  iEvent.getByToken(electronToken, electrons);
+  Handle<View<reco::Candidate> > taus;
+  iEvent.getByToken(tauToken, taus);
+
+  unsigned nMuons     = countAbove(*muons, muonPtMin);
+  unsigned nElectrons = countAbove(*electrons, electronPtMin);
+  unsigned nTaus      = countAbove(*taus, tauPtMin);
+
+  for (const Channel& ch : channels) {
+    if (nMuons < ch.nMuons || nElectrons < ch.nElectrons || nTaus < ch.nTaus) continue;
+    if (ch.triggers.empty()) return true;
+    for (unsigned bit : ch.triggerBits) {
+      if (triggerResults->accept(bit)) return true;
+    }
+  }
+  return false;
+}
+
+
+#include <FWCore/Framework/interface/MakerMacros.h>
+DEFINE_FWK_MODULE(PreSkimFilter);
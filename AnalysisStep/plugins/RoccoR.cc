@@ -4,6 +4,7 @@
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
+#include <algorithm>
 #include "RoccoR.h"
 
 const double CrystalBall::pi = 3.14159;
@@ -120,6 +121,17 @@ void RoccoR::reset(){
     nset=0;
     std::vector<int>().swap(nmem);
     std::vector<std::vector<RocOne>>().swap(RC);
+    NREP=0;
+    std::vector<double>().swap(repNmem);
+    for(TYPE T:{MC,DT}){
+	std::vector<double>().swap(repM[T]);
+	std::vector<double>().swap(repA[T]);
+    }
+    std::vector<double>().swap(repKData);
+    std::vector<double>().swap(repKMC);
+    std::vector<double>().swap(repKExtra);
+    for(auto &p: repRsPar) std::vector<double>().swap(p);
+    std::vector<CrystalBall>().swap(repCB);
 
 }
 
@@ -236,6 +248,57 @@ void RoccoR::init(std::string filename){
 		for(auto &i: r.cb) i.init();
 
     in.close();
+
+    initReplicas();
+}
+
+void RoccoR::initReplicas(){
+    NREP=0;
+    for(int s=0; s<nset; ++s) NREP+=nmem[s];
+    if(NREP==0) return;
+
+    const RocRes &RR0 = RC[0][0].RR;
+    int RETA = RR0.NETA;
+    int RTRK = RR0.NTRK;
+
+    repNmem.resize(NREP);
+    for(TYPE T:{MC,DT}){
+	repM[T].resize(NETA*NPHI*NREP);
+	repA[T].resize(NETA*NPHI*NREP);
+    }
+    repKData.resize(RETA*NREP);
+    repKMC.resize(RETA*NREP);
+    repKExtra.resize(RETA*NREP);
+    for(auto &p: repRsPar) p.resize(RETA*RTRK*NREP);
+    repCB.resize(RETA*RTRK*NREP);
+
+    int r=0;
+    for(int s=0; s<nset; ++s){
+	for(int m=0; m<nmem[s]; ++m, ++r){
+	    const RocOne &rc = RC[s][m];
+	    repNmem[r] = nmem[s];
+	    for(TYPE T:{MC,DT}){
+		for(int H=0; H<NETA; ++H){
+		    for(int F=0; F<NPHI; ++F){
+			repM[T][(H*NPHI+F)*NREP + r] = rc.CP[T][H][F].M;
+			repA[T][(H*NPHI+F)*NREP + r] = rc.CP[T][H][F].A;
+		    }
+		}
+	    }
+	    for(int H=0; H<RETA; ++H){
+		const RocRes::ResParams &rp = rc.RR.resol[H];
+		double d = rp.kRes[RocRes::Data];
+		double mc = rp.kRes[RocRes::MC];
+		repKData[H*NREP + r] = d;
+		repKMC[H*NREP + r] = mc;
+		repKExtra[H*NREP + r] = d>mc ? sqrt(d*d-mc*mc) : 0;
+		for(int F=0; F<RTRK; ++F){
+		    for(int i=0; i<3; ++i) repRsPar[i][(H*RTRK+F)*NREP + r] = rp.rsPar[i][F];
+		    repCB[(H*RTRK+F)*NREP + r] = rp.cb[F];
+		}
+	    }
+	}
+    }
 }
 
 const double RoccoR::MPHI=-CrystalBall::pi;
@@ -314,15 +377,83 @@ double RoccoR::error(T f) const{
 }
 
 double RoccoR::kScaleDTerror(int Q, double pt, double eta, double phi) const{
-    return error([this, Q, pt, eta, phi](int s, int m) {return kScaleDT(Q, pt, eta, phi, s, m);});
+    return kScaleDTwithError(Q, pt, eta, phi).error;
 }
 
 double RoccoR::kSpreadMCerror(int Q, double pt, double eta, double phi, double gt) const{
-    return error([this, Q, pt, eta, phi, gt](int s, int m){return kSpreadMC(Q, pt, eta, phi, gt, s, m);});
+    return kSpreadMCwithError(Q, pt, eta, phi, gt).error;
 }
 
 double RoccoR::kSmearMCerror(int Q, double pt, double eta, double phi, int n, double u) const{
-    return error([this, Q, pt, eta, phi, n, u](int s, int m){return kSmearMC(Q, pt, eta, phi, n, u, s, m);});
+    return kSmearMCwithError(Q, pt, eta, phi, n, u).error;
+}
+
+// The batched versions below reproduce kScaleDT, kSpreadMC and kSmearMC for every replica,
+// with the same arithmetic, and accumulate the error as in RoccoR::error.
+
+RoccoR::CorAndError RoccoR::kScaleDTwithError(int Q, double pt, double eta, double phi) const{
+    const int bin = (etaBin(eta)*NPHI + phiBin(phi))*NREP;
+    const double *M = &repM[DT][bin];
+    const double *A = &repA[DT][bin];
+    const double k0 = 1.0/(M[0] + Q*A[0]*pt);
+    double sum=0;
+    for(int r=0; r<NREP; ++r){
+	double d = 1.0/(M[r] + Q*A[r]*pt) - k0;
+	sum += d*d/repNmem[r];
+    }
+    return {k0, sqrt(sum)};
+}
+
+RoccoR::CorAndError RoccoR::kSpreadMCwithError(int Q, double pt, double eta, double phi, double gt) const{
+    const int bin = (etaBin(eta)*NPHI + phiBin(phi))*NREP;
+    const int res = RC[0][0].RR.etaBin(fabs(eta))*NREP;
+    const double *M = &repM[MC][bin];
+    const double *A = &repA[MC][bin];
+    const double *kD = &repKData[res];
+    const double *kM = &repKMC[res];
+    auto spread = [&](int r){
+	double k = 1.0/(M[r] + Q*A[r]*pt);
+	double x = gt/(k*pt);
+	return k*(x / (1.0 + (x-1.0)*kD[r]/kM[r]));
+    };
+    const double k0 = spread(0);
+    double sum=0;
+    for(int r=0; r<NREP; ++r){
+	double d = spread(r) - k0;
+	sum += d*d/repNmem[r];
+    }
+    return {k0, sqrt(sum)};
+}
+
+RoccoR::CorAndError RoccoR::kSmearMCwithError(int Q, double pt, double eta, double phi, int n, double u) const{
+    const RocRes &RR0 = RC[0][0].RR;
+    const int bin = (etaBin(eta)*NPHI + phiBin(phi))*NREP;
+    const int H = RR0.etaBin(fabs(eta));
+    // Tracker-layer bin. RocRes::kExtra does not bound n-NMIN and indexes cb[F] out of range
+    // (undefined behaviour) for n>=NMIN+NTRK; here F is clamped to the last bin so that the
+    // flat (eta, layer, replica) tables are never read outside the eta bin H.
+    const int F = std::min(n>RR0.NMIN ? n-RR0.NMIN : 0, RR0.NTRK-1);
+    const int res = (H*RR0.NTRK + F)*NREP;
+    const double *M = &repM[MC][bin];
+    const double *A = &repA[MC][bin];
+    const double *kE = &repKExtra[H*NREP];
+    const double *p0 = &repRsPar[0][res];
+    const double *p1 = &repRsPar[1][res];
+    const double *p2 = &repRsPar[2][res];
+    const CrystalBall *cb = &repCB[res];
+    auto smear = [&](int r){
+	double k = 1.0/(M[r] + Q*A[r]*pt);
+	double dpt = k*pt-45;
+	double x = kE[r]>0 ? kE[r] * (p0[r] + p1[r]*dpt + p2[r]*dpt*dpt) * cb[r].invcdf(u) : 0;
+	return x<=-1 ? k : k*(1.0/(1.0 + x));
+    };
+    const double k0 = smear(0);
+    double sum=0;
+    for(int r=0; r<NREP; ++r){
+	double d = smear(r) - k0;
+	sum += d*d/repNmem[r];
+    }
+    return {k0, sqrt(sum)};
 }
 
 double RoccoR::kScaleFromGenMCerror(int Q, double pt, double eta, double phi, int n, double gt, double w) const{
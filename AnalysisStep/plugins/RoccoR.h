@@ -147,7 +147,20 @@ class RoccoR{
 	int phiBin(double phi) const;
 	template <typename T> double error(T f) const;
 
+	// Parameters of all (set, member) replicas, stored contiguously per bin so that
+	// every replica can be evaluated in a single pass; replica 0 is the nominal one.
+	int NREP;
+	std::vector<double> repNmem;                // nmem of the set of each replica
+	std::vector<double> repM[2], repA[2];       // [(H*NPHI+F)*NREP + r]
+	std::vector<double> repKData, repKMC;       // kRes per resolution eta bin, [H*NREP + r]
+	std::vector<double> repKExtra;              // sqrt(kData^2-kMC^2), 0 if kData<=kMC
+	std::vector<double> repRsPar[3];            // [(H*NTRK+F)*NREP + r]
+	std::vector<CrystalBall> repCB;             // [(H*NTRK+F)*NREP + r]
+	void initReplicas();
+
     public:
+	struct CorAndError{double k; double error;};
+
 	RoccoR(); 
 	RoccoR(std::string filename); 
 	void init(std::string filename);
@@ -168,6 +181,11 @@ class RoccoR{
 	double kSpreadMCerror(int Q, double pt, double eta, double phi, double gt) const;
 	double kSmearMCerror(int Q, double pt, double eta, double phi, int n, double u) const;
 
+	// Nominal correction and its error, evaluating all replicas in one pass
+	CorAndError kScaleDTwithError(int Q, double pt, double eta, double phi) const;
+	CorAndError kSpreadMCwithError(int Q, double pt, double eta, double phi, double gt) const;
+	CorAndError kSmearMCwithError(int Q, double pt, double eta, double phi, int n, double u) const;
+
 	//old, should only be used with 2017v0
 	double kScaleFromGenMC(int Q, double pt, double eta, double phi, int n, double gt, double w, int s=0, int m=0) const; 
 	double kScaleAndSmearMC(int Q, double pt, double eta, double phi, int n, double u, double w, int s=0, int m=0) const;  
@@ -6,7 +6,7 @@
 
 
 #include <FWCore/Framework/interface/Frameworkfwd.h>
-#include <FWCore/Framework/interface/EDProducer.h>
+#include <FWCore/Framework/interface/global/EDProducer.h>
 #include <FWCore/Framework/interface/Event.h>
 #include <FWCore/ParameterSet/interface/ParameterSet.h>
 #include <FWCore/Framework/interface/ESHandle.h>
@@ -15,10 +15,10 @@
 
 // Rochester Muon Corrections
 #include <HTauTauHMuMu/AnalysisStep/plugins/RoccoR.h>
+#include <HTauTauHMuMu/AnalysisStep/interface/CounterRNG.h>
 
 
 #include "TLorentzVector.h"
-#include "TRandom3.h"
 
 
 #include <vector>
@@ -30,7 +30,7 @@ using namespace std;
 using namespace reco;
 
 
-class RochesterPATMuonCorrector : public edm::EDProducer {
+class RochesterPATMuonCorrector : public edm::global::EDProducer<> {
  public:
   /// Constructor
   explicit RochesterPATMuonCorrector(const edm::ParameterSet&);
@@ -41,17 +41,15 @@ class RochesterPATMuonCorrector : public edm::EDProducer {
   };
 
  private:
-  virtual void beginJob(){};
-  virtual void produce(edm::Event&, const edm::EventSetup&);
-  virtual void endJob(){};
+  void produce(edm::StreamID, edm::Event&, const edm::EventSetup&) const override;
 
   edm::EDGetTokenT<vector<pat::Muon> > muonToken_;
   string identifier_;
   bool isMC_;
   bool isSync_;
 
-  RoccoR* calibrator;
-  TRandom3* rgen_;
+  const RoccoR* calibrator;
+  unsigned int seed_; // smearing numbers are drawn from (seed, run, lumi, event, muon index)
 
 };
 
@@ -62,7 +60,7 @@ RochesterPATMuonCorrector::RochesterPATMuonCorrector(const edm::ParameterSet& iC
   isMC_(iConfig.getParameter<bool>("isMC")),
   isSync_(iConfig.getParameter<bool>("isSynchronization")),
   calibrator(0),
-  rgen_(0)
+  seed_(iConfig.getUntrackedParameter<unsigned int>("randomSeed", 0))
 {
   stringstream ss;
   ss << "HTauTauHMuMu/AnalysisStep/data/RochesterCorrections/" << identifier_ << ".txt";
@@ -70,14 +68,13 @@ RochesterPATMuonCorrector::RochesterPATMuonCorrector(const edm::ParameterSet& iC
   edm::FileInPath corrPath("HTauTauHMuMu/AnalysisStep/data/RochesterCorrections/"+identifier_+".txt");
 	
   calibrator = new RoccoR(corrPath.fullPath());
-  rgen_ = new TRandom3(0);
 	
   produces<pat::MuonCollection>();
 }
 
 
 void
-RochesterPATMuonCorrector::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
+RochesterPATMuonCorrector::produce(edm::StreamID, edm::Event& iEvent, const edm::EventSetup& iSetup) const
 {
   // Input collection
   edm::Handle<vector<pat::Muon> > muonHandle;
@@ -88,6 +85,7 @@ RochesterPATMuonCorrector::produce(edm::Event& iEvent, const edm::EventSetup& iS
   auto outputMuons = std::make_unique<vector<pat::Muon> >();
 
   TLorentzVector p4;
+  const edm::EventID& id = iEvent.id();
 	
   for (unsigned i=0; i<inputMuons->size(); ++i) {
 
@@ -102,7 +100,7 @@ RochesterPATMuonCorrector::produce(edm::Event& iEvent, const edm::EventSetup& iS
     double scale_factor;
     double scale_error = 0.;
     double smear_error = 0.;
-    double u = rgen_->Rndm();
+    double u = CounterRNG::uniform(seed_, id.run(), id.luminosityBlock(), id.event(), i);
       
     if(isSync_) u = 0.5;
 
@@ -117,14 +115,16 @@ RochesterPATMuonCorrector::produce(edm::Event& iEvent, const edm::EventSetup& iS
 			/// ====== ON MC (correction plus smearing) =====
 			if ( gen_particle != 0)
 			{
-				scale_factor = calibrator->kSpreadMC(mu.charge(), oldpt, mu.eta(), mu.phi(), gen_particle->pt());
-				smear_error = calibrator->kSpreadMCerror(mu.charge(), oldpt, mu.eta(), mu.phi(), gen_particle->pt());
+				RoccoR::CorAndError spread = calibrator->kSpreadMCwithError(mu.charge(), oldpt, mu.eta(), mu.phi(), gen_particle->pt());
+				scale_factor = spread.k;
+				smear_error = spread.error;
 				
 			}
 			else
 			{
-				scale_factor = calibrator->kSmearMC(mu.charge(), oldpt, mu.eta(), mu.phi(), nl, u);
-				smear_error = calibrator->kSmearMCerror(mu.charge(), oldpt, mu.eta(), mu.phi(), nl, u);
+				RoccoR::CorAndError smear = calibrator->kSmearMCwithError(mu.charge(), oldpt, mu.eta(), mu.phi(), nl, u);
+				scale_factor = smear.k;
+				smear_error = smear.error;
 				
 			}
 			
@@ -139,8 +139,9 @@ RochesterPATMuonCorrector::produce(edm::Event& iEvent, const edm::EventSetup& iS
 			/// ====== ON DATA (correction only) =====
 			if(mu.pt()>2.0 && fabs(mu.eta())<2.4)//protection, we don't use these muons anyway
 			{
-			  scale_factor = calibrator->kScaleDT(mu.charge(), oldpt, mu.eta(), mu.phi());
-			  scale_error = calibrator->kScaleDTerror(mu.charge(), oldpt, mu.eta(), mu.phi());
+			  RoccoR::CorAndError scale = calibrator->kScaleDTwithError(mu.charge(), oldpt, mu.eta(), mu.phi());
+			  scale_factor = scale.k;
+			  scale_error = scale.error;
 			  smear_error = calibrator->kSmearMCerror(mu.charge(), oldpt, mu.eta(), mu.phi(), nl, u);//there is no smear in data so calculate it pretending it is mc
 			}
 			else
@@ -0,0 +1,151 @@
+/*
+** class  : ShiftMET
+** brief  : takes in input the met, the uncorrected taus (bareTaus), the corrected taus (softTaus) and the jets
+**          and produces in a single pass a pat::METCollection with the met shifted for the central tau and jet
+**          corrections and for the JES, JER, TES, EES and MES variations; see interface/METShifts.h for the layout
+*/
+
+#include <FWCore/Framework/interface/Frameworkfwd.h>
+#include <FWCore/Framework/interface/global/EDProducer.h>
+#include <FWCore/Framework/interface/Event.h>
+#include <FWCore/Framework/interface/ESHandle.h>
+#include <FWCore/MessageLogger/interface/MessageLogger.h>
+#include <FWCore/ParameterSet/interface/ParameterSet.h>
+#include <FWCore/Utilities/interface/InputTag.h>
+#include <DataFormats/PatCandidates/interface/MET.h>
+#include <DataFormats/PatCandidates/interface/Tau.h>
+#include <DataFormats/PatCandidates/interface/Jet.h>
+#include <DataFormats/Candidate/interface/Candidate.h>
+#include <HTauTauHMuMu/AnalysisStep/interface/METShifts.h>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+using namespace edm;
+using namespace std;
+using namespace METShifts;
+
+class ShiftMET : public edm::global::EDProducer<> {
+    public:
+        /// Constructor
+        explicit ShiftMET(const edm::ParameterSet&);
+        /// Destructor
+        ~ShiftMET(){};
+
+    private:
+        void produce(edm::StreamID, edm::Event&, const edm::EventSetup&) const override;
+
+        edm::EDGetTokenT<View<pat::MET>> theMETTag;
+        edm::EDGetTokenT<pat::TauRefVector> theTauUncorrectedTag;
+        edm::EDGetTokenT<pat::TauCollection> theTauCorrectedTag;
+        edm::EDGetTokenT<View<pat::Jet>> theJetTag;
+};
+
+ShiftMET::ShiftMET(const edm::ParameterSet& iConfig) :
+theMETTag(consumes<View<pat::MET>>(iConfig.getParameter<edm::InputTag>("srcMET"))),
+theTauUncorrectedTag(consumes<pat::TauRefVector>(iConfig.getParameter<edm::InputTag>("tauUncorrected"))),
+theTauCorrectedTag(consumes<pat::TauCollection>(iConfig.getParameter<edm::InputTag>("tauCorrected"))),
+theJetTag(consumes<View<pat::Jet>>(iConfig.getParameter<edm::InputTag>("jetCollection")))
+{
+    produces<pat::METCollection>();
+}
+
+void ShiftMET::produce(edm::StreamID, edm::Event& iEvent, const edm::EventSetup& iSetup) const
+{
+    std::unique_ptr<pat::METCollection> out_MET_ptr(new pat::METCollection());
+    out_MET_ptr->reserve(METShifts::size);
+
+    // Get the MET
+    Handle<View<pat::MET> > METHandle;
+    iEvent.getByToken(theMETTag, METHandle);
+    const pat::MET& patMET = (*METHandle)[0];
+
+    // Get the Uncorrected Taus
+    Handle<pat::TauRefVector> tauUncorrectedHandle;
+    iEvent.getByToken(theTauUncorrectedTag, tauUncorrectedHandle);
+
+    // Get the Corrected Taus
+    Handle<pat::TauCollection> tauCorrectedHandle;
+    iEvent.getByToken(theTauCorrectedTag, tauCorrectedHandle);
+
+    // Get Jets
+    Handle<View<pat::Jet>> jetHandle;
+    iEvent.getByToken(theJetTag, jetHandle);
+
+    // Sum of (shifted - unshifted) object momenta, per position in the output
+    std::array<double, METShifts::size> dx{}, dy{};
+    auto addShift = [&dx, &dy](unsigned source, double dxUp, double dyUp, double dxDn, double dyDn) {
+        dx[METShifts::index(source, true)]  += dxUp; dy[METShifts::index(source, true)]  += dyUp;
+        dx[METShifts::index(source, false)] += dxDn; dy[METShifts::index(source, false)] += dyDn;
+    };
+
+    // Loop on taus
+    for (unsigned itau = 0; itau < tauCorrectedHandle->size(); ++itau) {
+        const pat::Tau& tau = (*tauCorrectedHandle)[itau];
+        const pat::Tau& tauUncorrected = *(*tauUncorrectedHandle)[itau];
+        const double px = tau.px(), py = tau.py();
+
+        dx[kTauOnly] += px - tauUncorrected.px();
+        dy[kTauOnly] += py - tauUncorrected.py();
+
+        if (tau.hasUserInt("isTESShifted") && tau.userInt("isTESShifted")) {
+            addShift(kTES, tau.userFloat("px_TauUp") - px, tau.userFloat("py_TauUp") - py,
+                           tau.userFloat("px_TauDown") - px, tau.userFloat("py_TauDown") - py);
+        }
+        if (tau.hasUserInt("isEESShifted") && tau.userInt("isEESShifted")) {
+            addShift(kEES, tau.userFloat("px_EleUp") - px, tau.userFloat("py_EleUp") - py,
+                           tau.userFloat("px_EleDown") - px, tau.userFloat("py_EleDown") - py);
+        }
+        float genmatch = tau.userFloat("genmatch");
+        if (genmatch == 2 || genmatch == 4) {
+            addShift(kMES, px*1.01 - px, py*1.01 - py, px*0.99 - px, py*0.99 - py);
+        }
+    }
+
+    // Loop on jets
+    for (const pat::Jet& j : *jetHandle) {
+        const double px = j.px(), py = j.py(), pt = j.pt();
+
+        if (pt <= 0) continue;
+
+        double f = 1 - j.userFloat("pt_JEC_noJER")/pt;
+        dx[kJetOnly] += px*f;
+        dy[kJetOnly] += py*f;
+
+        // pt_jerup/pt_jerdn are -1 when JER is not applied (data): no JER shift, i.e. nominal MET
+        const float ptJERUp = j.userFloat("pt_jerup"), ptJERDn = j.userFloat("pt_jerdn");
+        double up = ptJERUp < 0 ? 1. : ptJERUp/pt;
+        double dn = ptJERDn < 0 ? 1. : ptJERDn/pt;
+        addShift(kJER, px*up - px, py*up - py, px*dn - px, py*dn - py);
+
+        const JetShifts& jes = JetShifts::get(j);
+        for (unsigned s = 0; s < JetShifts::nSources; ++s) {
+            up = jes.ptUp[s]/pt;
+            dn = jes.ptDn[s]/pt;
+            addShift(kJES + s, px*up - px, py*up - py, px*dn - px, py*dn - py);
+        }
+    }
+
+    auto pushMET = [&](float shiftMetPx, float shiftMetPy) {
+        reco::Candidate::LorentzVector shiftedMetP4(shiftMetPx, shiftMetPy, 0., sqrt(shiftMetPx*shiftMetPx + shiftMetPy*shiftMetPy));
+        pat::MET corrMEt(patMET);
+        corrMEt.setP4(shiftedMetP4);
+        corrMEt.setSignificanceMatrix(patMET.getSignificanceMatrix());
+        out_MET_ptr->push_back(corrMEt);
+    };
+
+    // raw one
+    out_MET_ptr->push_back(patMET);
+    // central corrections
+    pushMET(patMET.px() - dx[kTauOnly] - dx[kJetOnly], patMET.py() - dy[kTauOnly] - dy[kJetOnly]);
+    pushMET(patMET.px() - dx[kTauOnly], patMET.py() - dy[kTauOnly]);
+    pushMET(patMET.px() - dx[kJetOnly], patMET.py() - dy[kJetOnly]);
+    // variations
+    for (unsigned i = nCentral; i < METShifts::size; ++i) pushMET(patMET.px() - dx[i], patMET.py() - dy[i]);
+
+    iEvent.put(std::move(out_MET_ptr));
+}
+
+#include <FWCore/Framework/interface/MakerMacros.h>
+DEFINE_FWK_MODULE(ShiftMET);
@@ -8,7 +8,7 @@
  */
 
 #include <FWCore/Framework/interface/Frameworkfwd.h>
-#include <FWCore/Framework/interface/EDProducer.h>
+#include <FWCore/Framework/interface/stream/EDProducer.h>
 #include <FWCore/Framework/interface/Event.h>
 #include <FWCore/ParameterSet/interface/ParameterSet.h>
 #include <FWCore/Framework/interface/ESHandle.h>
@@ -19,6 +19,7 @@
 #include <HTauTauHMuMu/AnalysisStep/interface/DaughterDataHelpers.h>
 #include <HTauTauHMuMu/AnalysisStep/interface/CutSet.h>
 #include <HTauTauHMuMu/AnalysisStep/interface/LeptonIsoHelper.h>
+#include <HTauTauHMuMu/AnalysisStep/interface/GenSummary.h>
 //#include "BDTId.h"
 
 #include <vector>
@@ -34,7 +35,7 @@ using namespace reco;
 
 //bool recomputeBDT = false;
 
-class TauFiller : public edm::EDProducer {
+class TauFiller : public edm::stream::EDProducer<> {
  public:
   /// Constructor
   explicit TauFiller(const edm::ParameterSet&);
@@ -44,15 +45,14 @@ class TauFiller : public edm::EDProducer {
 
   //ByIsolationMVA3oldDMwoLTraw
  private:
-  virtual void beginJob(){};  
-  virtual void produce(edm::Event&, const edm::EventSetup&);
-  virtual void endJob(){};
+  void produce(edm::Event&, const edm::EventSetup&) override;
 
   edm::EDGetTokenT<pat::TauRefVector> theCandidateTag;
   edm::EDGetTokenT<edm::View<reco::GenParticle> > theGenTag ;
+  edm::EDGetTokenT<GenSummary> theGenSummaryTag ;
   edm::EDGetTokenT<vector<Vertex> > theVtxTag ;
   const std::string theDiscriminatorTag;
-  const StringCutObjectSelector<pat::Tau, true> cut;
+  const CompiledCut<pat::Tau> cut;
   const CutSet<pat::Tau> flags;
   const bool ApplyTESCentralCorr; // shift the central TES value
 
@@ -73,6 +73,7 @@ class TauFiller : public edm::EDProducer {
 TauFiller::TauFiller(const edm::ParameterSet& iConfig) :
   theCandidateTag(consumes<pat::TauRefVector>(iConfig.getParameter<InputTag>("src"))),
   theGenTag(consumes<edm::View<reco::GenParticle> >(iConfig.getParameter<edm::InputTag>("genCollection"))),
+  theGenSummaryTag(consumes<GenSummary>(iConfig.getParameter<edm::InputTag>("genSummary"))),
   theVtxTag(consumes<vector<Vertex>>(iConfig.getParameter<edm::InputTag>("vtxCollection"))),
   theDiscriminatorTag(iConfig.getParameter<std::string>("discriminator")),
   cut(iConfig.getParameter<std::string>("cut")),
@@ -219,20 +220,14 @@ using LorentzVectorE = ROOT::Math::LorentzVector<ROOT::Math::PtEtaPhiE4D<double>
 // Return original Tau Mother genParticle:
 // given a genParticle, go back in the chain of the gen particles until
 // you find the last tau (i.e. the tau that has as mother not a tau)
-const reco::GenParticle getMother (const reco::GenParticle genP)
+const reco::GenParticle* getMother (const reco::GenParticle* genP)
 {
-  //std::cout << "  * first genPart - pdg: " << genP.pdgId() << " - isPrompt: " << genP.statusFlags().isPrompt() << " - momentum: " << genP.momentum() << endl;
-  reco::GenParticleRef genM = genP.motherRef(0);
-  assert(genM.isNonnull() && genM.isAvailable());  // sanity
-  if (std::abs(genP.pdgId())==15 && std::abs(genM->pdgId())!=15)
+  while (true)
   {
-    //std::cout << "    returning daughter  - pdg: " << genP.pdgId() << " - isPrompt: " << genP.statusFlags().isPrompt() << " - momentum: " << genP.momentum() << endl;
-    return genP;
-  }
-  else
-  {
-    //std::cout << "    retrying with mother  - pdg: " << genM->pdgId() << " - isPrompt: " << genM->statusFlags().isPrompt() << " - momentum: " << genM->momentum() << endl;
-    return getMother(*genM);
+    reco::GenParticleRef genM = genP->motherRef(0);
+    assert(genM.isNonnull() && genM.isAvailable());  // sanity
+    if (std::abs(genP->pdgId())==15 && std::abs(genM->pdgId())!=15) return genP;
+    genP = genM.get();
   }
 }
 
@@ -252,6 +247,20 @@ TauFiller::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
   edm::Handle<edm::View<reco::GenParticle> > genHandle;
   iEvent.getByToken(theGenTag, genHandle);
 
+  // Prompt gen electrons and muons, for the e/mu->tau fake matching (MC only)
+  edm::Handle<GenSummary> genSummary;
+  iEvent.getByToken(theGenSummaryTag, genSummary);
+  std::vector<const GenParticle*> promptGenLeptons;
+  if (genHandle.isValid() && genSummary.isValid()) promptGenLeptons = genSummary->particles(genHandle, genSummary->promptLeptons);
+
+  // Gen Higgs bosons, for the fromH flag (MC only)
+  std::vector<const GenParticle*> genHiggs;
+  if (genHandle.isValid())
+  {
+    for (const GenParticle& genP : *genHandle)
+      if (std::abs(genP.pdgId()) == 25) genHiggs.push_back(&genP);
+  }
+
   // TES corrections
   Int_t binDM0  = TESh1->GetXaxis()->FindBin((int)0);
   Int_t binDM1  = TESh1->GetXaxis()->FindBin(1);
@@ -294,11 +303,10 @@ TauFiller::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
 
       // Get the original tau mother starting from one of the constituents of the genJet,
       // it does not matther which one, so we use element '0' --> genParts[0]
-      const reco::GenParticle returned = getMother(*(genParts[0]));
-      //std::cout << "  Returned - pdg: " << returned.pdgId() << " - isPrompt: " << returned.statusFlags().isPrompt() << " - momentum: " << returned.momentum() << endl;
+      const reco::GenParticle* returned = getMother(genParts[0]);
 
       // Check if the original tau mother isPrompt or not
-      isTauPrompt = returned.statusFlags().isPrompt();
+      isTauPrompt = returned->statusFlags().isPrompt();
     }
 
     if ( l.genJet() && deltaR(l.p4(), l.genJet()->p4()) < 0.3 && l.genJet()->pt() > 15. && ((std::abs(l.genJet()->pt()-l.pt())/l.genJet()->pt()) < 1.0) && isTauPrompt && ApplyTESCentralCorr)
@@ -354,17 +362,16 @@ TauFiller::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
       //https://github.com/KIT-CMS/Artus/blob/dictchanges/KappaAnalysis/src/Utility/GeneratorInfo.cc#L77-L165
       if (genHandle.isValid())
       {
-        GenParticle closest = (GenParticle) (*genHandle)[0] ;
+        const GenParticle* closest = nullptr;
         double closestDR = 999;
 
-        for (unsigned int iGen = 0; iGen < genHandle->size(); iGen++)
+        // promptGenLeptons are already the e/mu with pt>8 that are prompt or direct prompt tau decay products
+        for (const GenParticle* genP : promptGenLeptons)
         {
-          const GenParticle& genP = (*genHandle)[iGen];
-          int genP_pdgId = std::abs(genP.pdgId());
-          double deltaPTpT = std::abs( genP.pt() - l.pt() ) / genP.pt() ;
-          if (genP.pt() > 8. && (genP_pdgId == 11 || genP_pdgId == 13) && (genP.statusFlags().isPrompt() || genP.statusFlags().isDirectPromptTauDecayProduct()) && deltaPTpT < 0.5)
+          double deltaPTpT = std::abs( genP->pt() - l.pt() ) / genP->pt() ;
+          if (deltaPTpT < 0.5)
           {
-            double tmpDR = deltaR(l.p4(), genP.p4());
+            double tmpDR = deltaR(l.p4(), genP->p4());
             if (tmpDR < closestDR)
             {
               closest = genP;
@@ -375,11 +382,11 @@ TauFiller::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
 
         if (closestDR < 0.3)
         {
-          int pdgId = std::abs(closest.pdgId());
-          if      (pdgId == 11 && closest.pt() > 8. && closest.statusFlags().isPrompt()) genmatch = 1;
-          else if (pdgId == 13 && closest.pt() > 8. && closest.statusFlags().isPrompt()) genmatch = 2;
-          else if (pdgId == 11 && closest.pt() > 8. && closest.statusFlags().isDirectPromptTauDecayProduct()) genmatch = 3;
-          else if (pdgId == 13 && closest.pt() > 8. && closest.statusFlags().isDirectPromptTauDecayProduct()) genmatch = 4;
+          int pdgId = std::abs(closest->pdgId());
+          if      (pdgId == 11 && closest->statusFlags().isPrompt()) genmatch = 1;
+          else if (pdgId == 13 && closest->statusFlags().isPrompt()) genmatch = 2;
+          else if (pdgId == 11 && closest->statusFlags().isDirectPromptTauDecayProduct()) genmatch = 3;
+          else if (pdgId == 13 && closest->statusFlags().isDirectPromptTauDecayProduct()) genmatch = 4;
         }
       } // end genHandle.isValid()
     } // end !isTauMatched
@@ -770,15 +777,10 @@ TauFiller::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
       }
       
       //search if it comes from H
-      Handle<edm::View<reco::GenParticle> > genHandle;
-      iEvent.getByToken(theGenTag, genHandle);
-      for(unsigned int ipruned = 0; ipruned< genHandle->size(); ++ipruned){
-        int pdgmot = (&(*genHandle)[ipruned])->pdgId();
-        if(abs(pdgmot)==25){
-          if(userdatahelpers::isAncestor(&(*genHandle)[ipruned],genL)){
-            fromH=1;
-            break;
-          }
+      for (const GenParticle* genH : genHiggs){
+        if(userdatahelpers::isAncestor(genH,genL)){
+          fromH=1;
+          break;
         }
       }
     }
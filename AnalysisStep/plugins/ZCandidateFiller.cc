@@ -9,12 +9,13 @@
  */
 
 #include <FWCore/Framework/interface/Frameworkfwd.h>
-#include <FWCore/Framework/interface/EDProducer.h>
+#include <FWCore/Framework/interface/stream/EDProducer.h>
 #include <FWCore/Framework/interface/Event.h>
 #include <FWCore/ParameterSet/interface/ParameterSet.h>
 #include <FWCore/Framework/interface/ESHandle.h>
 #include <FWCore/MessageLogger/interface/MessageLogger.h>
 #include <FWCore/Utilities/interface/InputTag.h>
+#include <FWCore/Utilities/interface/Exception.h>
 
 #include <CommonTools/Utils/interface/StringCutObjectSelector.h>
 #include <CommonTools/Utils/interface/StringObjectFunction.h>
@@ -34,6 +35,7 @@
 #include <HTauTauHMuMu/AnalysisStep/interface/CutSet.h>
 #include <HTauTauHMuMu/AnalysisStep/interface/LeptonIsoHelper.h>
 #include <HTauTauHMuMu/AnalysisStep/interface/DaughterDataHelpers.h>
+#include <HTauTauHMuMu/AnalysisStep/interface/EtaPhiGrid.h>
 
 #include <TLorentzVector.h>
 #include <string>
@@ -41,6 +43,8 @@
 #include <vector>
 #include <string>
 #include <cmath>
+#include <cstdint>
+#include <unordered_map>
 
 using namespace edm;
 using namespace std;
@@ -49,7 +53,7 @@ using namespace reco;
 using METUncertainty = pat::MET::METUncertainty;
 
 
-class ZCandidateFiller : public edm::EDProducer {
+class ZCandidateFiller : public edm::stream::EDProducer<> {
  public:
   /// Constructor
   explicit ZCandidateFiller(const edm::ParameterSet&);
@@ -58,13 +62,11 @@ class ZCandidateFiller : public edm::EDProducer {
   ~ZCandidateFiller(){};  
 
  private:
-  virtual void beginJob(){};  
-  virtual void produce(edm::Event&, const edm::EventSetup&);
-  virtual void endJob(){};
-  bool triggerFlavour(pat::TriggerObjectStandAlone OBJ, int flavour);
+  void produce(edm::Event&, const edm::EventSetup&) override;
+  bool triggerFlavour(const pat::TriggerObjectStandAlone& OBJ, int flavour);
 
   edm::EDGetTokenT<edm::View<reco::CompositeCandidate> > candidateToken;
-  const StringCutObjectSelector<pat::CompositeCandidate, true> preBestZSelection;
+  const CompiledCut<pat::CompositeCandidate> preBestZSelection;
   const edm::EDGetTokenT<pat::TriggerObjectStandAloneCollection> triggerObjects_;
   const edm::EDGetTokenT< edm::TriggerResults > triggerResultsToken_;
   edm::EDGetTokenT<edm::View<reco::Candidate> > softLeptonToken;
@@ -85,6 +87,29 @@ class ZCandidateFiller : public edm::EDProducer {
   vector<string> EleTauPaths, EleTauFilters, EleTauFiltersLeg1, EleTauFiltersLeg2; vector<float> EleTauFiltersDZ, EleTauFiltersDR;
   vector<string> MuElePaths, MuEleFilters, MuEleFiltersLeg1, MuEleFiltersLeg2; vector<float> MuEleFiltersDZ, MuEleFiltersDR;
 
+  // The filter labels above are numbered once, so that the labels of each trigger object
+  // can be stored as a bitmask and matching reduces to integer ANDs.
+  struct TriggerSet {
+    vector<string> SinglePaths, DiPaths;
+    vector<uint64_t> SingleBits, DiBits, DiBitsLeg1, DiBitsLeg2;
+    vector<float> DZ, DR, minMass;
+  };
+  // Trigger object with its filter labels unpacked into a bitmask
+  struct TriggerObjectBits {
+    const pat::TriggerObjectStandAlone* obj;
+    uint64_t filters;
+    unsigned flavours; // flavourBit() of the lepton flavours it can match
+  };
+  uint64_t filterBit(const string& label);
+  TriggerSet makeTriggerSet(const vector<string>& singlePaths, const vector<string>& singleFilters,
+                            const vector<string>& diPaths, const vector<string>& diFilters,
+                            const vector<string>& diFiltersLeg1, const vector<string>& diFiltersLeg2,
+                            const vector<float>& dz, const vector<float>& dr);
+  static unsigned flavourBit(int pdgId);
+
+  std::unordered_map<string, unsigned> filterIndex;
+  TriggerSet MuMuTriggers, EleTauTriggers, MuTauTriggers, TauTauTriggers, MuEleTriggers;
+
 
   enum pairType {
     kMuHad  = 0,
@@ -505,11 +530,66 @@ ZCandidateFiller::ZCandidateFiller(const edm::ParameterSet& iConfig) :
       MuEleFiltersDZ = {0.2,0.2};
       MuEleFiltersDR = {-1,-1};
   }
+
+  MuMuTriggers = makeTriggerSet(SingleMuPaths, SingleMuFilters, DiMuPaths, DiMuFilters, DiMuFiltersLeg1, DiMuFiltersLeg2, DiMuFiltersDZ, DiMuFiltersDR);
+  EleTauTriggers = makeTriggerSet(SingleElePaths, SingleEleFilters, EleTauPaths, EleTauFilters, EleTauFiltersLeg1, EleTauFiltersLeg2, EleTauFiltersDZ, EleTauFiltersDR);
+  MuTauTriggers = makeTriggerSet(SingleMuPaths, SingleMuFilters, MuTauPaths, MuTauFilters, MuTauFiltersLeg1, MuTauFiltersLeg2, MuTauFiltersDZ, MuTauFiltersDR);
+  TauTauTriggers = makeTriggerSet(vector<string>(), vector<string>(), DiTauPaths, DiTauFilters, DiTauFiltersLeg1, DiTauFiltersLeg2, DiTauFiltersDZ, DiTauFiltersDR);
+  vector<string> SingleMuElePaths(SingleMuPaths), SingleMuEleFilters(SingleMuFilters);
+  SingleMuElePaths.insert(SingleMuElePaths.end(),SingleElePaths.begin(),SingleElePaths.end());
+  SingleMuEleFilters.insert(SingleMuEleFilters.end(),SingleEleFilters.begin(),SingleEleFilters.end());
+  MuEleTriggers = makeTriggerSet(SingleMuElePaths, SingleMuEleFilters, MuElePaths, MuEleFilters, MuEleFiltersLeg1, MuEleFiltersLeg2, MuEleFiltersDZ, MuEleFiltersDR);
   
   produces<pat::CompositeCandidateCollection>();
 }
 
 
+uint64_t ZCandidateFiller::filterBit(const string& label)
+{
+  auto it = filterIndex.find(label);
+  if (it == filterIndex.end()) {
+    if (filterIndex.size() >= 64) throw cms::Exception("ZCandidateFiller") << "More than 64 distinct HLT filter labels configured";
+    it = filterIndex.emplace(label, filterIndex.size()).first;
+  }
+  return uint64_t(1) << it->second;
+}
+
+
+ZCandidateFiller::TriggerSet ZCandidateFiller::makeTriggerSet(const vector<string>& singlePaths, const vector<string>& singleFilters,
+                                                              const vector<string>& diPaths, const vector<string>& diFilters,
+                                                              const vector<string>& diFiltersLeg1, const vector<string>& diFiltersLeg2,
+                                                              const vector<float>& dz, const vector<float>& dr)
+{
+  TriggerSet trg;
+  trg.SinglePaths = singlePaths;
+  for (size_t itrg=0; itrg<singlePaths.size(); itrg++) trg.SingleBits.push_back(filterBit(singleFilters[itrg]));
+  trg.DiPaths = diPaths;
+  trg.DZ = dz;
+  trg.DR = dr;
+  for (size_t itrg=0; itrg<diPaths.size(); itrg++) {
+    trg.DiBits.push_back(filterBit(diFilters[itrg]));
+    trg.DiBitsLeg1.push_back(filterBit(diFiltersLeg1[itrg]));
+    trg.DiBitsLeg2.push_back(filterBit(diFiltersLeg2[itrg]));
+    float minMass = -1;
+    if (diPaths[itrg].find("Mass3p8")!=string::npos) minMass = 3.8;
+    if (diPaths[itrg].find("Mass8")!=string::npos) minMass = 8;
+    trg.minMass.push_back(minMass);
+  }
+  return trg;
+}
+
+
+unsigned ZCandidateFiller::flavourBit(int pdgId)
+{
+  switch (abs(pdgId)) {
+  case 11: return 1;
+  case 13: return 2;
+  case 15: return 4;
+  default: return 0;
+  }
+}
+
+
 void ZCandidateFiller::produce(edm::Event& iEvent, const edm::EventSetup& iSetup)
 {  
   using namespace edm;
@@ -528,6 +608,30 @@ void ZCandidateFiller::produce(edm::Event& iEvent, const edm::EventSetup& iSetup
   edm::Handle<pat::TriggerObjectStandAloneCollection> triggerObjects;
   iEvent.getByToken(triggerObjects_, triggerObjects);
 
+  //-- Unpack the filter labels of each trigger object once per event
+  vector<TriggerObjectBits> trigObjs;
+  if (LLCands->size()>0) {
+    trigObjs.reserve(triggerObjects->size());
+    for (const pat::TriggerObjectStandAlone& obj : *triggerObjects) {
+      pat::TriggerObjectStandAlone unpacked(obj);
+      unpacked.unpackFilterLabels(iEvent,*triggerResults);
+      TriggerObjectBits t{&obj, 0, 0};
+      for (const string& label : unpacked.filterLabels()) {
+        auto it = filterIndex.find(label);
+        if (it != filterIndex.end()) t.filters |= uint64_t(1) << it->second;
+      }
+      for (int id : {11, 13, 15}) {
+        if (triggerFlavour(obj,id)) t.flavours |= flavourBit(id);
+      }
+      trigObjs.push_back(t);
+    }
+  }
+  // Cells of the matching cone size (dR<0.5): each lepton only looks at nearby objects
+  EtaPhiGrid trigGrid(0.5);
+  trigGrid.build(trigObjs.size(),
+                 [&](size_t i) { return trigObjs[i].obj->eta(); },
+                 [&](size_t i) { return trigObjs[i].obj->phi(); });
+
   Handle<View<reco::Candidate> > softleptoncoll;
   iEvent.getByToken(softLeptonToken, softleptoncoll);
   vector<reco::CandidatePtr> goodisoleptonPtrs;
@@ -690,94 +794,59 @@ void ZCandidateFiller::produce(edm::Event& iEvent, const edm::EventSetup& iSetup
 
     // const edm::TriggerNames &names = iEvent.triggerNames(*triggerResults);
 
-    vector<bool> HLTMatch_singleLeg1, HLTMatch_singleLeg2, HLTMatch_cross;
-    vector<string> SinglePaths,SingleFilters,DiPaths,DiFilters,DiFiltersLeg1,DiFiltersLeg2;
-    vector<float> DZ,DR;
-    
-    if (abs(id0*id1)==169) {//mumu
-        SinglePaths=SingleMuPaths; SingleFilters=SingleMuFilters;
-        DiPaths=DiMuPaths; DiFilters=DiMuFilters; DiFiltersLeg1=DiMuFiltersLeg1; DiFiltersLeg2=DiMuFiltersLeg2; 
-        DZ=DiMuFiltersDZ; DR=DiMuFiltersDR;
-    }
-    else if (abs(id0*id1)==165) {//etau
-        SinglePaths=SingleElePaths; SingleFilters=SingleEleFilters;
-        DiPaths=EleTauPaths; DiFilters=EleTauFilters; DiFiltersLeg1=EleTauFiltersLeg1; DiFiltersLeg2=EleTauFiltersLeg2; 
-        DZ=EleTauFiltersDZ; DR=EleTauFiltersDR;
-    }
-    else if (abs(id0*id1)==195) {//mutau
-        SinglePaths=SingleMuPaths; SingleFilters=SingleMuFilters;
-        DiPaths=MuTauPaths; DiFilters=MuTauFilters; DiFiltersLeg1=MuTauFiltersLeg1; DiFiltersLeg2=MuTauFiltersLeg2; 
-        DZ=MuTauFiltersDZ; DR=MuTauFiltersDR;
-    }
-    else if (abs(id0*id1)==225) {//tautau
-        DiPaths=DiTauPaths; DiFilters=DiTauFilters; DiFiltersLeg1=DiTauFiltersLeg1; DiFiltersLeg2=DiTauFiltersLeg2; 
-        DZ=DiTauFiltersDZ; DR=DiTauFiltersDR;
-    }
-    else if (abs(id0*id1)==143) {//emu
-        SinglePaths.clear();
-        SinglePaths.insert(SinglePaths.end(),SingleMuPaths.begin(),SingleMuPaths.end());
-        SinglePaths.insert(SinglePaths.end(),SingleElePaths.begin(),SingleElePaths.end());
-        SingleFilters.clear();
-        SingleFilters.insert(SingleFilters.end(),SingleMuFilters.begin(),SingleMuFilters.end());
-        SingleFilters.insert(SingleFilters.end(),SingleEleFilters.begin(),SingleEleFilters.end());
-        DiPaths=MuElePaths; DiFilters=MuEleFilters; DiFiltersLeg1=MuEleFiltersLeg1; DiFiltersLeg2=MuEleFiltersLeg2; 
-        DZ=MuEleFiltersDZ; DR=MuEleFiltersDR;
-    }
+    const TriggerSet* trg = 0;
+    if (abs(id0*id1)==169) trg = &MuMuTriggers; //mumu
+    else if (abs(id0*id1)==165) trg = &EleTauTriggers; //etau
+    else if (abs(id0*id1)==195) trg = &MuTauTriggers; //mutau
+    else if (abs(id0*id1)==225) trg = &TauTauTriggers; //tautau
+    else if (abs(id0*id1)==143) trg = &MuEleTriggers; //emu
     else {
         cout<<"Wrong flavour: "<<id0*id1<<endl;
         continue;
     }
-    
-    for (size_t itrg=0; itrg<SinglePaths.size();itrg++) {
-        HLTMatch_singleLeg1.push_back(false);
-        HLTMatch_singleLeg2.push_back(false);
-    }
-    
-    // cout<<"step 1"<<endl;
-    for (size_t idxto = 0; idxto < triggerObjects->size(); ++idxto) {//single triggers
-        pat::TriggerObjectStandAlone obj = triggerObjects->at(idxto);
-        obj.unpackFilterLabels(iEvent,*triggerResults);
-        // obj.unpackPathNames(names);
-        // if (id0*id1==-165) cout<<SinglePaths.size()<<endl;
-        if (deltaR2(*l1,obj)<0.25 && triggerFlavour(obj,id0) && SinglePaths.size() > 0) {
-            // if (id0*id1==-165) cout<<SinglePaths.size()<<endl;
-            for (size_t itrg=0; itrg<SinglePaths.size();itrg++) {
-                // if (id0*id1==-165) cout<<SingleFilters[itrg]<<endl;
-                if (obj.hasFilterLabel(SingleFilters[itrg])) HLTMatch_singleLeg1[itrg]=true;
-            }
+    const vector<string>& SinglePaths = trg->SinglePaths;
+    const vector<string>& DiPaths = trg->DiPaths;
+
+    //Trigger objects matched to each leg, and the union of their filters for single triggers
+    vector<const TriggerObjectBits*> objsLeg1, objsLeg2;
+    uint64_t filtersLeg1 = 0, filtersLeg2 = 0;
+    trigGrid.forEachNear(l1->eta(), l1->phi(), [&](unsigned idx) {
+        const TriggerObjectBits& t = trigObjs[idx];
+        if ((t.flavours & flavourBit(id0)) && deltaR2(*l1,*t.obj)<0.25) {
+            objsLeg1.push_back(&t);
+            filtersLeg1 |= t.filters;
         }
-        if (deltaR2(*l2,obj)<0.25 && triggerFlavour(obj,id1) && SinglePaths.size() > 0) {
-            // if (id0*id1==-165) cout<<SinglePaths.size()<<endl;
-            for (size_t itrg=0; itrg<SinglePaths.size();itrg++) {
-                // if (id0*id1==-165) cout<<SingleFilters[itrg]<<endl;
-                if (obj.hasFilterLabel(SingleFilters[itrg])) HLTMatch_singleLeg2[itrg]=true;
-            }
+    });
+    trigGrid.forEachNear(l2->eta(), l2->phi(), [&](unsigned idx) {
+        const TriggerObjectBits& t = trigObjs[idx];
+        if ((t.flavours & flavourBit(id1)) && deltaR2(*l2,*t.obj)<0.25) {
+            objsLeg2.push_back(&t);
+            filtersLeg2 |= t.filters;
         }
+    });
+
+    vector<bool> HLTMatch_singleLeg1(SinglePaths.size()), HLTMatch_singleLeg2(SinglePaths.size()), HLTMatch_cross(DiPaths.size());
+    for (size_t itrg=0; itrg<SinglePaths.size();itrg++) {
+        HLTMatch_singleLeg1[itrg] = filtersLeg1 & trg->SingleBits[itrg];
+        HLTMatch_singleLeg2[itrg] = filtersLeg2 & trg->SingleBits[itrg];
     }
-    // cout<<"step 2"<<endl;
-    for (size_t itrg=0; itrg<DiPaths.size();itrg++) {
-        HLTMatch_cross.push_back(false);
-    }
-    for (size_t idxto = 0; idxto < triggerObjects->size(); ++idxto) {//cross triggers
-        pat::TriggerObjectStandAlone obj1 = triggerObjects->at(idxto);
-        obj1.unpackFilterLabels(iEvent,*triggerResults );
-        // obj1.unpackPathNames(names);
-        for (size_t jdxto = 0; jdxto < triggerObjects->size(); ++jdxto) {
-            pat::TriggerObjectStandAlone obj2 = triggerObjects->at(jdxto);
-            obj2.unpackFilterLabels(iEvent,*triggerResults );
-            // obj2.unpackPathNames(names);
+
+    //Cross triggers: two distinct objects, one matched to each leg, sharing the path filter and
+    //carrying the two leg filters in either order
+    for (const TriggerObjectBits* t1 : objsLeg1) {
+        for (const TriggerObjectBits* t2 : objsLeg2) {
+            const pat::TriggerObjectStandAlone& obj1 = *t1->obj;
+            const pat::TriggerObjectStandAlone& obj2 = *t2->obj;
             if (deltaR(obj1,obj2)<0.02) continue;
-            if ( (deltaR2(*l1,obj1)<0.25 && triggerFlavour(obj1,id0) && deltaR2(*l2,obj2)<0.25 && triggerFlavour(obj2,id1) ) || (deltaR2(*l1,obj2)<0.25 && triggerFlavour(obj2,id0) && deltaR2(*l2,obj1)<0.25 && triggerFlavour(obj1,id1) )) {
-                for (size_t itrg=0;itrg<DiPaths.size();itrg++) {
-                    if (obj1.hasFilterLabel(DiFilters[itrg]) && obj2.hasFilterLabel(DiFilters[itrg])) {
-                        if ( ( obj1.hasFilterLabel(DiFiltersLeg1[itrg]) && obj2.hasFilterLabel(DiFiltersLeg2[itrg]) ) || ( obj1.hasFilterLabel(DiFiltersLeg2[itrg]) && obj2.hasFilterLabel(DiFiltersLeg1[itrg]) ) ) {
-                            float dr=deltaR(obj1,obj2);
-                            float dz=abs(obj1.vz()-obj2.vz());
-                            if ((DZ[itrg]<0 || dz<=DZ[itrg]) && (DR[itrg]<0 || dr>=DR[itrg])) {
-                                if ( (DiPaths[itrg].find("Mass3p8")==string::npos || (obj1.p4()+obj2.p4()).M() > 3.8) && (DiPaths[itrg].find("Mass8")==string::npos || (obj1.p4()+obj2.p4()).M() > 8) ) {
-                                    HLTMatch_cross[itrg]=true;
-                                }
-                            }
+            uint64_t common = t1->filters & t2->filters;
+            for (size_t itrg=0;itrg<DiPaths.size();itrg++) {
+                if (HLTMatch_cross[itrg] || !(common & trg->DiBits[itrg])) continue;
+                if ( ( (t1->filters & trg->DiBitsLeg1[itrg]) && (t2->filters & trg->DiBitsLeg2[itrg]) ) || ( (t1->filters & trg->DiBitsLeg2[itrg]) && (t2->filters & trg->DiBitsLeg1[itrg]) ) ) {
+                    float dr=deltaR(obj1,obj2);
+                    float dz=abs(obj1.vz()-obj2.vz());
+                    if ((trg->DZ[itrg]<0 || dz<=trg->DZ[itrg]) && (trg->DR[itrg]<0 || dr>=trg->DR[itrg])) {
+                        if (trg->minMass[itrg]<0 || (obj1.p4()+obj2.p4()).M() > trg->minMass[itrg]) {
+                            HLTMatch_cross[itrg]=true;
                         }
                     }
                 }
@@ -877,7 +946,7 @@ void ZCandidateFiller::produce(edm::Event& iEvent, const edm::EventSetup& iSetup
   iEvent.put(std::move(result));
 }
 
-bool ZCandidateFiller::triggerFlavour(pat::TriggerObjectStandAlone OBJ, int flavour)
+bool ZCandidateFiller::triggerFlavour(const pat::TriggerObjectStandAlone& OBJ, int flavour)
 {
     if (abs(flavour)==11)
         return ( OBJ.hasTriggerObjectType(trigger::TriggerElectron) || OBJ.hasTriggerObjectType(trigger::TriggerPhoton) );
@@ -7,7 +7,7 @@
  */
 
 #include <FWCore/Framework/interface/Frameworkfwd.h>
-#include <FWCore/Framework/interface/EDProducer.h>
+#include <FWCore/Framework/interface/stream/EDProducer.h>
 #include <FWCore/Framework/interface/Event.h>
 #include <FWCore/Framework/interface/ESHandle.h>
 #include <FWCore/ParameterSet/interface/ParameterSet.h>
@@ -58,7 +58,7 @@ typedef std::vector<SimpleParticle_t> SimpleParticleCollection_t;
 
 bool doVtxFit = false;
 
-class ZZCandidateFiller : public edm::EDProducer {
+class ZZCandidateFiller : public edm::stream::EDProducer<> {
 public:
   /// Constructor
   explicit ZZCandidateFiller(const edm::ParameterSet&);
@@ -69,9 +69,7 @@ public:
 private:
   typedef map<const reco::Candidate*, const pat::PFParticle*> FSRToLepMap;
 
-  virtual void beginJob(){};
-  virtual void produce(edm::Event&, const edm::EventSetup&);
-  virtual void endJob(){};
+  void produce(edm::Event&, const edm::EventSetup&) override;
 
   void getPairMass(const reco::Candidate* lp, const reco::Candidate* lm, FSRToLepMap& photons, float& mass, int& ID);
 
@@ -99,8 +97,6 @@ private:
 //  edm::EDGetTokenT<pat::METCollection> metToken;
   edm::EDGetTokenT<edm::View<reco::Candidate> > softLeptonToken;
   edm::EDGetTokenT<edm::View<reco::CompositeCandidate> > ZCandToken;
-   
-  int _num_of_JEC_variations;
 };
 
 
@@ -128,9 +124,6 @@ ZZCandidateFiller::ZZCandidateFiller(const edm::ParameterSet& iConfig) :
   rolesZ1Z2 = {"Z1", "Z2"};
   rolesZ2Z1 = {"Z2", "Z1"};
 
-  // _num_of_JEC_variations = 5; // Define number of total JEC variations 4 (JESUp, JESDn, JERUp, JERDn) + 1 for Nominal
-  _num_of_JEC_variations = 27; // Define number of total JEC variations 26 (JESUp, JESDn, + 11 sources for JEC splitting of unc + JERUp, JERDn) + 1 for Nominal
-
   if (setup < 2015) {// FIXME:  EbE corrections to be updated for Run II
     // Run I ebe corrections; obsolete
     edm::FileInPath fip("HTauTauHMuMu/AnalysisStep/data/ebeOverallCorrections.Legacy2013.v0.root");
@@ -484,7 +477,6 @@ void ZZCandidateFiller::produce(edm::Event& iEvent, const edm::EventSetup& iSetu
     //--- store good isolated leptons that are not involved in the current ZZ candidate
     if (debug) cout<<"Extra leptons"<<endl;
     int nExtraLep = 0;
-    SimpleParticleCollection_t associatedLeptons;
     for (vector<reco::CandidatePtr>::const_iterator lepPtr = goodisoleptonPtrs.begin(); lepPtr != goodisoleptonPtrs.end(); ++lepPtr){
       const reco::Candidate* lep = lepPtr->get();
       if (
@@ -495,55 +487,10 @@ void ZZCandidateFiller::produce(edm::Event& iEvent, const edm::EventSetup& iSetu
         ){
         nExtraLep++;
         myCand.addUserCand("ExtraLep"+to_string(nExtraLep), *lepPtr);
-
-        SimpleParticle_t theLepton(
-        lep->pdgId(),
-        TLorentzVector(lep->p4().x(), lep->p4().y(), lep->p4().z(), lep->p4().t())
-        );
-        bool inserted=false;
-        for (SimpleParticleCollection_t::iterator ielo=associatedLeptons.begin(); ielo<associatedLeptons.end(); ielo++){
-          if (lep->pt()>(*ielo).second.Pt()){
-            inserted=true;
-            associatedLeptons.insert(ielo, theLepton);
-            break;
-          }
-        }
-        if (!inserted) associatedLeptons.push_back(theLepton);
       }
     }
     myCand.addUserFloat("nExtraLep",nExtraLep);
 
-    // Leptonically decaying WH
-    if (debug) cout<<"Extra W"<<endl;
-    if (nExtraLep>=1){
-      // Take leading-pT lepton to compute fake neutrino
-      int nuid = -associatedLeptons.at(0).first + (associatedLeptons.at(0).first>0 ? -1 : +1);
-
-      // Take neutrino momentum from the MET, using a W mass constraint to solve for the z component
-      float a = associatedLeptons.at(0).second.X();
-      float b = associatedLeptons.at(0).second.Y();
-      float c = associatedLeptons.at(0).second.Z();
-      float f = associatedLeptons.at(0).second.T();
-      TLorentzVector myLep(a, b, c, f);
-      float x = PFMET*cos(PFMETPhi);
-      float y = PFMET*sin(PFMETPhi);
-      float m = 80.399;//PDGHelpers::Wmass;
-      float delta = pow(c*(-4*a*a - 4*b*b - 4*c*c + 4*f*f - 4*m*m - 8*a*x - 8*b*y), 2) - 4*(-4*c*c + 4*f*f)*(-a*a*a*a - 2*a*a*b*b - b*b*b*b - 2*a*a*c*c - 2*b*b*c*c - c*c*c*c + 2*a*a*f*f + 2*b*b*f*f + 2*c*c*f*f - f*f*f*f - 2*a*a*m*m - 2*b*b*m*m - 2*c*c*m*m + 2*f*f*m*m - m*m*m*m - 4*a*a*a*x - 4*a*b*b*x - 4*a*c*c*x + 4*a*f*f*x - 4*a*m*m*x - 4*a*a*x*x + 4*f*f*x*x - 4*a*a*b*y - 4*b*b*b*y - 4*b*c*c*y + 4*b*f*f*y - 4*b*m*m*y - 8*a*b*x*y - 4*b*b*y*y + 4*f*f*y*y);
-
-      if (delta>=0.){
-        float z1 = (-c*(-4*a*a - 4*b*b - 4*c*c + 4*f*f - 4*m*m - 8*a*x - 8*b*y) - sqrt(delta)) / (2*(-4*c*c + 4*f*f));
-        float z2 = (-c*(-4*a*a - 4*b*b - 4*c*c + 4*f*f - 4*m*m - 8*a*x - 8*b*y) + sqrt(delta)) / (2*(-4*c*c + 4*f*f));
-        TLorentzVector myNu0(x, y, z1, sqrt(x*x+y*y+z1*z1));
-        TLorentzVector myNu1(x, y, z2, sqrt(x*x+y*y+z2*z2));
-        associatedLeptons.push_back(SimpleParticle_t(nuid, myNu0));
-        associatedLeptons.push_back(SimpleParticle_t(nuid, myNu1));
-      }
-      else{
-        TLorentzVector myNu(x, y, 0, TMath::Sqrt(x*x+y*y));
-        associatedLeptons.push_back(SimpleParticle_t(nuid, myNu));
-      }
-    }
-
 
     //--- store Z candidates whose leptons are not involved in the current ZZ candidate
     if (debug) cout<<"Extra Z"<<endl;
@@ -603,213 +550,30 @@ void ZZCandidateFiller::produce(edm::Event& iEvent, const edm::EventSetup& iSetu
     float DiJetDEta  = -99;
     float ZZjjPt     = -99;
 
-    unsigned int nCandidates=0; // Should equal jecnum after the loop below
-    
-    // Loop over following JEC variations:
-    // JES
-    // JER
-    if (debug) cout<<"JES, JER"<<endl;
-    for (int jecnum = 0; jecnum < _num_of_JEC_variations; jecnum++){
-      SimpleParticleCollection_t associated;
-
-      vector<const pat::Jet*> cleanedJetsPt30Jec;
-      vector<float> jec_ratio;
-      for (edm::View<pat::Jet>::const_iterator jet = CleanJets->begin(); jet != CleanJets->end(); ++jet){
-        
-        // Nominal jet
-        float ratio = 1.;
-        float newPt = jet->pt();
-        
-        // calculate all JEC uncertainty up/down
-        
-        //JES Up uncertainty - COMBINED
-        if (jecnum == 1 )      {
-           ratio = 1. + jet->userFloat("jes_unc");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Up uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 2 )      {
-           ratio = 1. + jet->userFloat("jes_unc_split_Abs");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Up uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 3 )      {
-           ratio = 1. + jet->userFloat("jes_unc_split_Abs_year");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Up uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 4 )      {
-           ratio = 1. + jet->userFloat("jes_unc_split_BBEC1");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Up uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 5 )      {
-           ratio = 1. + jet->userFloat("jes_unc_split_BBEC1_year");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Up uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 6 )      {
-           ratio = 1. + jet->userFloat("jes_unc_split_EC2");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Up uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 7 )      {
-           ratio = 1. + jet->userFloat("jes_unc_split_EC2_year");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Up uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 8 )      {
-           ratio = 1. + jet->userFloat("jes_unc_split_FlavQCD");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Up uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 9 )      {
-           ratio = 1. + jet->userFloat("jes_unc_split_HF");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Up uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 10 )      {
-           ratio = 1. + jet->userFloat("jes_unc_split_HF_year");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Up uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 11 )      {
-           ratio = 1. + jet->userFloat("jes_unc_split_RelBal");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Up uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 12 )      {
-           ratio = 1. + jet->userFloat("jes_unc_split_RelSample_year");
-           newPt = jet->pt() * ratio;
-        }
-
-        //JES Down uncertainty - COMBINED
-        else if (jecnum == 13 ) {
-           ratio = 1. - jet->userFloat("jes_unc");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Down uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 14 )      {
-           ratio = 1. - jet->userFloat("jes_unc_split_Abs");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Down uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 15 )      {
-           ratio = 1. - jet->userFloat("jes_unc_split_Abs_year");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Down uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 16 )      {
-           ratio = 1. - jet->userFloat("jes_unc_split_BBEC1");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Down uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 17 )      {
-           ratio = 1. - jet->userFloat("jes_unc_split_BBEC1_year");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Down uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 18 )      {
-           ratio = 1. - jet->userFloat("jes_unc_split_EC2");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Down uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 19 )      {
-           ratio = 1. - jet->userFloat("jes_unc_split_EC2_year");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Down uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 20 )      {
-           ratio = 1. - jet->userFloat("jes_unc_split_FlavQCD");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Down uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 21 )      {
-           ratio = 1. - jet->userFloat("jes_unc_split_HF");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Down uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 22 )      {
-           ratio = 1. - jet->userFloat("jes_unc_split_HF_year");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Down uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 23 )      {
-           ratio = 1. - jet->userFloat("jes_unc_split_RelBal");
-           newPt = jet->pt() * ratio;
-        }
-        //JES Down uncertainty - SPLITTED in 11 sources
-        else if (jecnum == 24 )      {
-           ratio = 1. - jet->userFloat("jes_unc_split_RelSample_year");
-           newPt = jet->pt() * ratio;
-        }
+    // Additional jet cleaning for loose leptons belonging to this candidate (for CRs only;
+    // does nothing for the SR as jets are already cleaned with all tight isolated leptons)
+    // Leading two cleaned jets with pt>30 GeV
+    const pat::Jet* lead[2] = {nullptr, nullptr};
+    for (const pat::Jet& jet : *CleanJets){
+      if (jet.pt()<=30. || !jetCleaner::isGood(myCand, jet)) continue;
+      if (lead[0]==nullptr) lead[0] = &jet;
+      else { lead[1] = &jet; break; }
+    }
+    if (lead[1]!=nullptr){
+      DiJetDEta = lead[0]->eta()-lead[1]->eta();
+      DiJetMass = (lead[0]->p4()+lead[1]->p4()).M();
+    }
 
-        //JER Up uncertainty
-        else if (jecnum == 25 ) {
-           ratio = jet->userFloat("pt_jerup") / jet->pt();
-           newPt = jet->userFloat("pt_jerup");
-        }
-        //JER Down uncertainty
-        else if (jecnum == 26 ) {
-           ratio = jet->userFloat("pt_jerdn") / jet->pt();
-           newPt = jet->userFloat("pt_jerdn");
-        }
+    vector<const pat::Jet*> cleanedJetsPt30;
+    for (edm::View<pat::Jet>::const_iterator jet = CleanJets->begin(); jet != CleanJets->end(); ++jet){
+      if (jet->pt() > 30.) cleanedJetsPt30.push_back(&*jet);
+    }
 
-        // To add new uncertainties you have to:
-        // 1) Update _num_of_JEC_variations
-        // 2) Add their ration calculation here
-        // 3) Update updateMELAClusters_J1JEC and updateMELAClusters_J2JEC functions with names for new variations
-        // 4) Update RecoProbabilities.py and RecoProbabilities_minimal.py with those same names
-        
-        // apply pt>30GeV cut
-        if (newPt<=30.) continue;
-        // additional jets cleaning for loose leptons belonging to this candidate (for CRs only;
-        // does nothing for the SR as jets are already cleaned with all tight isolated leptons )
-        if (!jetCleaner::isGood(myCand, *jet)) continue;
-        // store jets and up/down ratio
-        cleanedJetsPt30Jec.push_back(&*jet);
-        jec_ratio.push_back(ratio);
-      }
-      if (jecnum==0 && cleanedJetsPt30Jec.size()>1){
-        const pat::Jet& jet1 = *(cleanedJetsPt30Jec.at(0));
-        const pat::Jet& jet2 = *(cleanedJetsPt30Jec.at(1));
-        DiJetDEta = jet1.eta()-jet2.eta();
-        DiJetMass = (jet1.p4()+jet2.p4()).M();
-      }
-      
-      vector<const pat::Jet*> cleanedJetsPt30;
-      for (edm::View<pat::Jet>::const_iterator jet = CleanJets->begin(); jet != CleanJets->end(); ++jet){
-        if (jet->pt() > 30.) cleanedJetsPt30.push_back(&*jet);
-      }
-      
-      if(cleanedJetsPt30.size() > 1)
-      {
-        const pat::Jet& jet1 = *(cleanedJetsPt30.at(0));
-        const pat::Jet& jet2 = *(cleanedJetsPt30.at(1));
-        ZZjjPt = (Z1Lm->p4()+Z1Lp->p4()+Z2Lm->p4()+Z2Lp->p4()+jet1.p4()+jet2.p4()).pt();
-      }
-      
-      for (unsigned int ijet = 0; ijet<cleanedJetsPt30Jec.size(); ijet++){
-        TLorentzVector jet(
-          cleanedJetsPt30Jec[ijet]->p4().x()*jec_ratio.at(ijet),
-          cleanedJetsPt30Jec[ijet]->p4().y()*jec_ratio.at(ijet),
-          cleanedJetsPt30Jec[ijet]->p4().z()*jec_ratio.at(ijet),
-          cleanedJetsPt30Jec[ijet]->p4().t()*jec_ratio.at(ijet)
-          );
-        associated.push_back(SimpleParticle_t(0, jet));
-      }
-      for (unsigned int ilep=0; ilep<associatedLeptons.size(); ilep++) associated.push_back(associatedLeptons.at(ilep));
-      for (unsigned int ijet = 0; ijet<cleanedJetsPt30Jec.size(); ijet++){
-        TLorentzVector jet(
-          cleanedJetsPt30Jec[ijet]->p4().x()*jec_ratio.at(ijet),
-          cleanedJetsPt30Jec[ijet]->p4().y()*jec_ratio.at(ijet),
-          cleanedJetsPt30Jec[ijet]->p4().z()*jec_ratio.at(ijet),
-	  cleanedJetsPt30Jec[ijet]->p4().t()*jec_ratio.at(ijet)
- 	  );
-        SimpleParticleCollection_t stableTopDaughters; // Just a collection with one jet as the top
-        stableTopDaughters.push_back(SimpleParticle_t(0, jet));
-      }
-      nCandidates++;
+    if(cleanedJetsPt30.size() > 1)
+    {
+      const pat::Jet& jet1 = *(cleanedJetsPt30.at(0));
+      const pat::Jet& jet2 = *(cleanedJetsPt30.at(1));
+      ZZjjPt = (Z1Lm->p4()+Z1Lp->p4()+Z2Lm->p4()+Z2Lp->p4()+jet1.p4()+jet2.p4()).pt();
     }
 
 
@@ -16,8 +16,6 @@
 
 #include "RecoParticleFlow/PFClusterTools/interface/PFEnergyResolution.h"
 
-#include <TMatrixD.h>
-
 void CompositeCandMassResolution::init(const edm::EventSetup &iSetup) {
     iSetup.get<IdealMagneticFieldRecord>().get(magfield_);
 }
@@ -51,54 +49,42 @@ double CompositeCandMassResolution::getMassResolutionWithComponents(const reco::
 double CompositeCandMassResolution::getMassResolution_(const reco::Candidate &c, std::vector<double> &errs, bool doComponents) const {
     std::vector<const reco::Candidate *> leaves;
     getLeaves(c, leaves);
-    int n = leaves.size(), ndim = n*3;
-    TMatrixDSym bigCov(ndim);
-    TMatrixD jacobian(1,ndim);
-    for (int i = 0, o = 0; i < n; ++i, o += 3) {
+    int n = leaves.size();
+    if (doComponents) errs.resize(n);
+
+    // The covariance of the leaf momenta is block diagonal (one 3x3 block per leaf),
+    // so J^T C J is the sum of the quadratic forms of the blocks, and each of them
+    // is the contribution of that leaf alone.
+    double dm2 = 0.;
+    for (int i = 0; i < n; ++i) {
         const reco::Candidate &ci = *leaves[i];
-        fillP3Covariance(ci, bigCov, o);
-        jacobian(0, o+0) = (c.energy()*(ci.px()/ci.energy()) - c.px())/c.mass();
-        jacobian(0, o+1) = (c.energy()*(ci.py()/ci.energy()) - c.py())/c.mass();
-        jacobian(0, o+2) = (c.energy()*(ci.pz()/ci.energy()) - c.pz())/c.mass();
-    }
-
-    /*static int debug_ = 0;
-    if (++debug_ < 20) {
-        std::cout << "Big matrix:   " << std::endl; bigCov.Print();
-        std::cout << "Jacobian:     " << std::endl; jacobian.Print();
-    }*/
-    if (doComponents) {
-        errs.resize(n);
-        for (int i = 0, o = 0; i < n; ++i, o += 3) {
-            TMatrixDSym bigCovOne(ndim);
-            for (int ir = 0; ir < 3; ++ir) { for (int ic = 0; ic < 3; ++ic) {
-                bigCovOne(o+ir,o+ic) = bigCov(o+ir,o+ic);
-            } }
-            double dm2 = bigCovOne.Similarity(jacobian)(0,0);
-            errs[i] = dm2 > 0 ? std::sqrt(dm2) : 0.0;
-        }
+        AlgebraicSymMatrix33 cov;
+        fillP3Covariance(ci, cov);
+        AlgebraicVector3 jacobian((c.energy()*(ci.px()/ci.energy()) - c.px())/c.mass(),
+                                  (c.energy()*(ci.py()/ci.energy()) - c.py())/c.mass(),
+                                  (c.energy()*(ci.pz()/ci.energy()) - c.pz())/c.mass());
+        double dm2i = ROOT::Math::Similarity(jacobian, cov);
+        if (doComponents) errs[i] = dm2i > 0 ? std::sqrt(dm2i) : 0.0;
+        dm2 += dm2i;
     }
 
-    TMatrixDSym massCov = bigCov.Similarity(jacobian);
-   
-    double dm2 = massCov(0,0);
     return (dm2 > 0 ? std::sqrt(dm2) : 0.0);
 }
 
-void CompositeCandMassResolution::fillP3Covariance(const reco::Candidate &c, TMatrixDSym &bigCov, int offset) const {
+void CompositeCandMassResolution::fillP3Covariance(const reco::Candidate &c, AlgebraicSymMatrix33 &cov) const {
   const reco::GsfElectron *gsf=0; const reco::Muon *mu=0; const reco::PFCandidate *pf=0; const reco::LeafCandidate *ph =0;
   
 
   if ((gsf = dynamic_cast<const reco::GsfElectron *>(&c)) != 0) {
-    fillP3Covariance(*gsf, bigCov, offset);
+    fillP3Covariance(*gsf, cov);
   } else if ((mu = dynamic_cast<const reco::Muon *>(&c)) != 0) {
-    fillP3Covariance(*mu, bigCov, offset);
+    fillP3Covariance(*mu, cov);
   } else if ((pf = dynamic_cast<const reco::PFCandidate *>(&c)) != 0 && pf->pdgId() == 22) {
-    fillP3Covariance(*pf, bigCov, offset);
+    fillP3Covariance(*pf, cov);
   } else if ((ph = dynamic_cast<const reco::LeafCandidate * >(&c))!= 0 ) { //&& ph->pdgId() == 22){
     // case of FSR photon,which is assigned as LeafCandidate in the ZZ analysis  
     
-    fillP3Covariance(*ph, bigCov, offset);
+    fillP3Covariance(*ph, cov);
     
   } else {
     
@@ -107,25 +93,25 @@ void CompositeCandMassResolution::fillP3Covariance(const reco::Candidate &c, TMa
   }
 }
 
-void CompositeCandMassResolution::fillP3Covariance(const reco::Muon &c, TMatrixDSym &bigCov, int offset) const {
-    fillP3Covariance(c, *c.muonBestTrack(), bigCov, offset);
+void CompositeCandMassResolution::fillP3Covariance(const reco::Muon &c, AlgebraicSymMatrix33 &cov) const {
+    fillP3Covariance(c, *c.muonBestTrack(), cov);
 }
 
 
 // This to calculate the mass error in case of photons for the ZZAnalyis, where FSR photons are passed as LeafCandidates
-void CompositeCandMassResolution::fillP3Covariance(const reco::LeafCandidate &c, TMatrixDSym &bigCov, int offset) const {
+void CompositeCandMassResolution::fillP3Covariance(const reco::LeafCandidate &c, AlgebraicSymMatrix33 &cov) const {
 
   if (c.pdgId() != 22) 
     edm::LogWarning("Pdg Id mismatch") << "Treating errors as for Photons, but pdgId is "<< c.pdgId();
 
   reco::PFCandidate pfc(0,c.p4(),reco::PFCandidate::gamma);
-  fillP3Covariance(pfc, bigCov, offset);
+  fillP3Covariance(pfc, cov);
 }
 
 
 
 
-void CompositeCandMassResolution::fillP3Covariance(const reco::GsfElectron &c, TMatrixDSym &bigCov, int offset) const {
+void CompositeCandMassResolution::fillP3Covariance(const reco::GsfElectron &c, AlgebraicSymMatrix33 &cov) const {
     double dp = 0.;
     if (c.ecalDriven()) {
         dp = c.p4Error(reco::GsfElectron::P4_COMBINATION);
@@ -157,13 +143,10 @@ void CompositeCandMassResolution::fillP3Covariance(const reco::GsfElectron &c, T
     ptop3(0,0) = c.px()/c.p();
     ptop3(1,0) = c.py()/c.p();
     ptop3(2,0) = c.pz()/c.p();
-    AlgebraicSymMatrix33 mat = ROOT::Math::Similarity(ptop3, AlgebraicSymMatrix11(dp*dp) );
-    for (int i = 0; i < 3; ++i) { for (int j = 0; j < 3; ++j) {
-        bigCov(offset+i,offset+j) = mat(i,j);
-    } } 
+    cov = ROOT::Math::Similarity(ptop3, AlgebraicSymMatrix11(dp*dp) );
 }
 
-void CompositeCandMassResolution::fillP3Covariance(const reco::Candidate &c, const reco::Track &t, TMatrixDSym &bigCov, int offset) const {
+void CompositeCandMassResolution::fillP3Covariance(const reco::Candidate &c, const reco::Track &t, AlgebraicSymMatrix33 &cov) const {
       GlobalTrajectoryParameters gp(GlobalPoint(t.vx(), t.vy(),  t.vz()),
                     GlobalVector(t.px(),t.py(),t.pz()),
                     t.charge(),
@@ -172,12 +155,12 @@ void CompositeCandMassResolution::fillP3Covariance(const reco::Candidate &c, con
       CartesianTrajectoryError cartErr= ROOT::Math::Similarity(curv2cart.jacobian(), t.covariance());
       const AlgebraicSymMatrix66 mat = cartErr.matrix();
       for (int i = 0; i < 3; ++i) { for (int j = 0; j < 3; ++j) {
-            bigCov(offset+i,offset+j) = mat(i+3,j+3);
+            cov(i,j) = mat(i+3,j+3);
       } } 
 }
 
 
-void CompositeCandMassResolution::fillP3Covariance(const reco::PFCandidate &c, TMatrixDSym &bigCov, int offset) const {
+void CompositeCandMassResolution::fillP3Covariance(const reco::PFCandidate &c, AlgebraicSymMatrix33 &cov) const {
     double dp = PFEnergyResolution().getEnergyResolutionEm(c.energy(), c.eta());
     // In order to produce a 3x3 matrix, we need a jacobian from (p) to (px,py,pz), i.e.
     //            [ Px/P  ]                
@@ -187,8 +170,5 @@ void CompositeCandMassResolution::fillP3Covariance(const reco::PFCandidate &c, T
     ptop3(0,0) = c.px()/c.p();
     ptop3(1,0) = c.py()/c.p();
     ptop3(2,0) = c.pz()/c.p();
-    AlgebraicSymMatrix33 mat = ROOT::Math::Similarity(ptop3, AlgebraicSymMatrix11(dp*dp) );
-    for (int i = 0; i < 3; ++i) { for (int j = 0; j < 3; ++j) {
-        bigCov(offset+i,offset+j) = mat(i,j);
-    } } 
+    cov = ROOT::Math::Similarity(ptop3, AlgebraicSymMatrix11(dp*dp) );
 }
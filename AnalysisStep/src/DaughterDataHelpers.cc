@@ -36,7 +36,7 @@ void userdatahelpers::embedDaughterData(pat::CompositeCandidate& cand) {
 }
 
 
-float userdatahelpers::getUserFloat(const reco::Candidate* c, const char* name){
+float userdatahelpers::getUserFloat(const reco::Candidate* c, const std::string& name){
   if(c->hasMasterClone()) c = c->masterClone().get();
   if (const pat::Muon* mu = dynamic_cast<const pat::Muon*>(c)) {
     return mu->userFloat(name);
@@ -54,7 +54,7 @@ float userdatahelpers::getUserFloat(const reco::Candidate* c, const char* name){
   return 0;
 }
 
-bool userdatahelpers::hasUserFloat(const reco::Candidate* c, const char* name){
+bool userdatahelpers::hasUserFloat(const reco::Candidate* c, const std::string& name){
   if(c->hasMasterClone()) c = c->masterClone().get();
   if (const pat::Muon* mu = dynamic_cast<const pat::Muon*>(c)) {
     return mu->hasUserFloat(name);
@@ -72,7 +72,7 @@ bool userdatahelpers::hasUserFloat(const reco::Candidate* c, const char* name){
   return false;
 }
 
-int userdatahelpers::getUserInt(const reco::Candidate* c, const char* name){
+int userdatahelpers::getUserInt(const reco::Candidate* c, const std::string& name){
   const reco::Candidate* d;
   if(c->hasMasterClone()) d = c->masterClone().get();
   else d = c;
@@ -91,7 +91,7 @@ int userdatahelpers::getUserInt(const reco::Candidate* c, const char* name){
   return 0;
 }
 
-bool  userdatahelpers::hasUserInt(const reco::Candidate* c, const char* name)
+bool  userdatahelpers::hasUserInt(const reco::Candidate* c, const std::string& name)
 {
   const reco::Candidate* d;
   if(c->hasMasterClone()) d = c->masterClone().get();
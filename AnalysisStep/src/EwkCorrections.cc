@@ -1,99 +1,92 @@
 #include "HTauTauHMuMu/AnalysisStep/interface/EwkCorrections.h"
 #include "TLorentzVector.h"
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+
 typedef ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<double> > LorentzVector;
 
 namespace EwkCorrections
 {
 	//Read correction table
-	std::vector<std::vector<float>> readFile_and_loadEwkTable(TString dtag){
-		std::ifstream myReadFile;
-		std::vector<float> Table_line;
-		std::vector<std::vector<float>> Table_EWK;
-//		TString name;
-//		TString cmssw_path;
-//		cmssw_path = getenv("CMSSW_BASE");
-//		TString path = cmssw_path+"/src/HTauTauHMuMu/AnalysisStep/src/";
-//		
-//		if(dtag.Contains("ZZ")) name = path+"ZZ_EwkCorrections.dat";
-		myReadFile.open(dtag);
+	const EwkTable & readFile_and_loadEwkTable(TString dtag){
+		static std::map<std::string, EwkTable> cache;
+		static std::mutex cacheMutex;
+		std::lock_guard<std::mutex> lock(cacheMutex);
+
+		auto cached = cache.find(dtag.Data());
+		if(cached != cache.end()) return cached->second;
+
+		EwkTable & Table_EWK = cache[dtag.Data()];
+		std::ifstream myReadFile(dtag.Data());
 		if(!myReadFile.is_open()) std::cout << "WARNING: "+dtag+" NOT FOUND" << std::endl;
-		int Start=0;
-		while (!myReadFile.eof()){
-			Start++;
-			std::string output;
-			myReadFile >> output;
-			if(Start%5!=0) Table_line.push_back(atof(output.c_str()));
-			if(Start%5==0){
-				Table_line.push_back(atof(output.c_str()));
-				Table_EWK.push_back(Table_line);
-				Table_line.clear();
+		float sqrt_s_hat, t_hat, c_u, c_d, c_b;
+		while (myReadFile >> sqrt_s_hat >> t_hat >> c_u >> c_d >> c_b){
+			if(Table_EWK.sAxis.empty() || sqrt_s_hat != Table_EWK.sAxis.back()){ //new sqrt s hat block
+				Table_EWK.sAxis.push_back(sqrt_s_hat);
+				Table_EWK.blockBegin.push_back(Table_EWK.tAxis.size());
 			}
+			Table_EWK.tAxis.push_back(t_hat);
+			Table_EWK.corr.push_back({{c_u, c_d, c_b}});
 		}
-		myReadFile.close();
+		Table_EWK.blockBegin.push_back(Table_EWK.tAxis.size());
 		return Table_EWK;
 	}
 
 
-	//Find the right correction in the file	
-	std::vector<float> findCorrection(const std::vector<std::vector<float>> & Table_EWK, float sqrt_s_hat, float t_hat){
-		//find the range of sqrt s hat (each 200 lines it changes)
-		unsigned int j = 0;
-		float best = 0.8E+04; //highest value of sqrt s hat in the table
-		if( sqrt_s_hat > best) j = 39800; //in the very rare case where we have bigger s than our table (table is for 8TeV and we run at 13TeV)
-		else{
-			for(unsigned int i = 0 ; i < 40000 ; i = i+200){
-				if(fabs(sqrt_s_hat - Table_EWK[i][0]) < best){
-					best = fabs(sqrt_s_hat - Table_EWK[i][0]);
-					j = i;
-				}
-				else break ;
-			}
-		}
-		best = Table_EWK[j+199][1];
-		if(t_hat > best) j = j+199; //in the very rare case where we have bigger t than our table
-		else{
-			best = 0.1E+09;
-			for(unsigned int k = j ; k < j + 200 ; k++){
-				if(fabs(t_hat - Table_EWK[k][1]) < best){
-					best = fabs(t_hat - Table_EWK[k][1]);
-					j = k;
-				}
-				else break ;
-			}
+	//Index of the closest value to x in the ascending range [begin, end); ties go to the lower index
+	static unsigned int findClosest(const float* begin, const float* end, float x){
+		const float* it = std::lower_bound(begin, end, x);
+		if(it == end) return (end - begin) - 1; //also covers values beyond the table
+		if(it == begin) return 0;
+		if(fabs(x - *(it-1)) <= fabs(x - *it)) --it;
+		return it - begin;
+	}
+
+
+	//Find the right correction in the table
+	std::array<float,3> findCorrection(const EwkTable & Table_EWK, float sqrt_s_hat, float t_hat){
+		if(Table_EWK.sAxis.empty()) return {{0.f, 0.f, 0.f}};
+		//find the sqrt s hat block, then the t hat row within it
+		const float* sAxis = Table_EWK.sAxis.data();
+		unsigned int block = findClosest(sAxis, sAxis + Table_EWK.sAxis.size(), sqrt_s_hat);
+		const float* tBlock = Table_EWK.tAxis.data() + Table_EWK.blockBegin[block];
+		unsigned int nT = Table_EWK.blockBegin[block+1] - Table_EWK.blockBegin[block];
+		unsigned int j = Table_EWK.blockBegin[block] + findClosest(tBlock, tBlock + nT, t_hat);
+		return Table_EWK.corr[j]; //ewk corrections for quarks u/c, d/s, b
+	}
+
+
+	//Flavour of the leading incoming quark of the hardest subprocess
+	int incomingQuarkFlavour(const edm::View<reco::Candidate> & particles){
+		std::vector<const reco::Candidate*> genIncomingQuarks;
+		for( edm::View<reco::Candidate>::const_iterator genParticle = particles.begin(); genParticle != particles.end(); ++ genParticle ) {
+			if(fabs(genParticle->pdgId()) >= 1 && fabs(genParticle->pdgId()) <= 5 && genParticle->status() == 21) genIncomingQuarks.push_back(&*genParticle); //status 21 : incoming particles of hardest subprocess
 		}
-		std::vector<float> EWK_w2_vec;
-		EWK_w2_vec.push_back(Table_EWK[j][2]); //ewk corrections for quark u/c
-		EWK_w2_vec.push_back(Table_EWK[j][3]); //ewk corrections for quark d/s
-		EWK_w2_vec.push_back(Table_EWK[j][4]); //ewk corrections for quark b
-		return EWK_w2_vec ;
+		std::sort(genIncomingQuarks.begin(), genIncomingQuarks.end(), sort_CandidatesByPt);
+
+		int quark_type = 0; //Flavour of incident quark
+		if(genIncomingQuarks.size() > 0) quark_type = fabs(genIncomingQuarks[0]->pdgId()); //Works unless if gg->ZZ process : it shouldn't be the case as we're using POWHEG
+		return quark_type;
 	}
 
 
 	//The main function, will return the kfactor
 	double getEwkCorrections(const edm::Handle<edm::View<reco::Candidate> > & particles, 
-	                         const std::vector<std::vector<float>> & Table, 
+	                         const EwkTable & Table, 
 	                         const GenEventInfoProduct & eventInfo,
 	                         TLorentzVector Z1, TLorentzVector Z2) {
-	// , double & ewkCorrections_error){
-		double kFactor = 1.;
-
-                std::vector<const reco::Candidate*> genIncomingQuarks;
-		std::vector<const reco::Candidate*> genIncomingGluons;
-		std::vector<const reco::Candidate*> genLeptons;
-		std::vector<const reco::Candidate*> genNeutrinos;
+		return getEwkCorrections(incomingQuarkFlavour(*particles), Table, eventInfo, Z1, Z2);
+	}
 
-                for( edm::View<reco::Candidate>::const_iterator genParticle = particles->begin(); genParticle != particles->end(); ++ genParticle ) {
-			if(fabs(genParticle->pdgId()) >= 1 && fabs(genParticle->pdgId()) <= 5 && genParticle->status() == 21) genIncomingQuarks.push_back(&*genParticle); //status 21 : incoming particles of hardest subprocess
-			if(fabs(genParticle->pdgId()) == 21 && genParticle->status() == 21) genIncomingGluons.push_back(&*genParticle);
-			if(genParticle->status()==1 && (fabs(genParticle->pdgId())==11 || fabs(genParticle->pdgId())==13 || fabs(genParticle->pdgId())==15)) genLeptons.push_back(&*genParticle); //status 1 : final state
-			if(genParticle->status()==1 && (fabs(genParticle->pdgId())==12 || fabs(genParticle->pdgId())==14 || fabs(genParticle->pdgId())==16)) genNeutrinos.push_back(&*genParticle);
-		}
 
-		std::sort(genIncomingQuarks.begin(), genIncomingQuarks.end(), sort_CandidatesByPt);
-		std::sort(genIncomingGluons.begin(), genIncomingGluons.end(), sort_CandidatesByPt);
-		std::sort(genLeptons.begin(), genLeptons.end(), sort_CandidatesByPt);
-		std::sort(genNeutrinos.begin(), genNeutrinos.end(), sort_CandidatesByPt);
+	double getEwkCorrections(int quark_type, 
+	                         const EwkTable & Table, 
+	                         const GenEventInfoProduct & eventInfo,
+	                         TLorentzVector Z1, TLorentzVector Z2) {
+	// , double & ewkCorrections_error){
+		double kFactor = 1.;
 
 		if(!eventInfo.pdf()) return 1; //no corrections can be applied because we need x1 and x2 
 //		if( genLeptons.size() < 2 || genNeutrinos.size() < 2) return 1; //no corrections can be applied if we don't find our two Z's
@@ -132,10 +125,7 @@ namespace EwkCorrections
 		double m_z = 91.1876; //Z bosons assumed to be on-shell
 		double t_hat = m_z*m_z - 0.5*s_hat + cos_theta * sqrt( 0.25*s_hat*s_hat - m_z*m_z*s_hat );
 
-		int quark_type = 0; //Flavour of incident quark
-		if(genIncomingQuarks.size() > 0) quark_type = fabs(genIncomingQuarks[0]->pdgId()); //Works unless if gg->ZZ process : it shouldn't be the case as we're using POWHEG
-
-		std::vector<float> Correction_vec = findCorrection( Table, sqrt(s_hat), t_hat ); //Extract the corrections for the values of s and t computed
+		std::array<float,3> Correction_vec = findCorrection( Table, sqrt(s_hat), t_hat ); //Extract the corrections for the values of s and t computed
 		//std::cout << Correction_vec[0] << " " << Correction_vec[1] << sqrt(s_hat) << 2*m_z << std::endl;
 		
 		if(quark_type==1) kFactor = 1. + Correction_vec[1]; //d
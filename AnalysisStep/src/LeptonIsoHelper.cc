@@ -11,6 +11,7 @@
 
 #include <iostream>
 #include <map>
+#include <algorithm>
 
 using namespace std;
 using namespace edm;
@@ -218,7 +219,7 @@ float LeptonIsoHelper::combRelIsoPF(const pat::Tau& l) {
 
 
 // Adapted from Hengne's implementation at: https://github.com/VBF-HZZ/UFHHTauTauHMuMuRun2/blob/csa14/UFHZZ4LAna/interface/HZZ4LHelper.h#L3525
-void LeptonIsoHelper::fsrIso(const reco::PFCandidate* photon, edm::Handle<edm::View<pat::PackedCandidate> > pfcands, double& ptSumNe, double& ptSumCh, double & ptSumChByWorstPV) {
+void LeptonIsoHelper::fsrIso(const reco::PFCandidate* photon, const PFCandidateIndex& pfcands, double& ptSumNe, double& ptSumCh, double & ptSumChByWorstPV) {
 
   // hardcoded cut values
   const double cut_deltaR = 0.3; 
@@ -229,30 +230,37 @@ void LeptonIsoHelper::fsrIso(const reco::PFCandidate* photon, edm::Handle<edm::V
   ptSumCh=0.;
   ptSumChByWorstPV=0.;
   
-  map<const reco::Vertex*, double> ptSumByPV;
-  for( edm::View<pat::PackedCandidate>::const_iterator pf = pfcands->begin(); pf!=pfcands->end(); ++pf ) {
-    double dr = deltaR(photon->p4(), pf->p4()) ;
-    if (dr>=cut_deltaR) continue;
+  // Charged sum per PV: only a few PVs contribute within the cone, so a flat vector with
+  // linear search is cheaper than a map
+  typedef pair<const reco::Vertex*, double> PVSum;
+  vector<PVSum> ptSumByPV;
+  ptSumByPV.reserve(8);
 
-    int pdgId= abs(pf->pdgId());
+  const reco::Candidate::LorentzVector& gp4 = photon->p4();
+  pfcands.forEachInCone(gp4.eta(), gp4.phi(), [&](const pat::PackedCandidate& pf) {
+    double dr = deltaR(gp4, pf.p4()) ;
+    if (dr>=cut_deltaR) return;
+
+    int pdgId= abs(pf.pdgId());
 
     //neutral hadrons + photons
-    if (pf->charge()==0) {
-      if (dr>cut_deltaRself_ne && pf->pt()>0.5 && (pdgId==22|| pdgId==130)) {
-	ptSumNe += pf->pt();
+    if (pf.charge()==0) {
+      if (dr>cut_deltaRself_ne && pf.pt()>0.5 && (pdgId==22|| pdgId==130)) {
+	ptSumNe += pf.pt();
       }
       // charged hadrons 
     } else {
-      if (dr>cut_deltaRself_ch && pf->pt()> 0.2 && pdgId==211) {
-	ptSumCh += pf->pt();
-	ptSumByPV[pf->vertexRef().get()] += pf->pt();
+      if (dr>cut_deltaRself_ch && pf.pt()> 0.2 && pdgId==211) {
+	ptSumCh += pf.pt();
+	const reco::Vertex* pv = pf.vertexRef().get();
+	auto it = std::find_if(ptSumByPV.begin(), ptSumByPV.end(), [pv](const PVSum& p){return p.first==pv;});
+	if (it!=ptSumByPV.end()) it->second += pf.pt();
+	else ptSumByPV.push_back(PVSum(pv, pf.pt()));
       }
     }
-  }
+  });
 
-  //  std::for_each(ptSumByPV.begin(), ptSumByPV.end(), [](const pair<const reco::Vertex*, double>& p1){cout << p1.first << " " <<p1.second << endl;});
-  
-  if (ptSumByPV.size()>0) ptSumChByWorstPV = (std::max_element(ptSumByPV.begin(), ptSumByPV.end(), [](const pair<const reco::Vertex*, double>& p1, const pair<const reco::Vertex*, double>& p2){return (p1.second<p2.second);}))->second; // pick the largest one
+  if (ptSumByPV.size()>0) ptSumChByWorstPV = (std::max_element(ptSumByPV.begin(), ptSumByPV.end(), [](const PVSum& p1, const PVSum& p2){return (p1.second<p2.second);}))->second; // pick the largest one
 }
 
 
@@ -28,9 +28,12 @@
 #include "PhysicsTools/JetMCUtils/interface/CandMCTag.h"
 
 #include <HTauTauHMuMu/AnalysisStep/interface/FinalStates.h>
+#include <HTauTauHMuMu/AnalysisStep/interface/EtaPhiGrid.h>
 
 #include <boost/algorithm/string/predicate.hpp>
 
+#include <algorithm>
+
 using namespace std;
 using namespace reco;
 using namespace edm;
@@ -356,29 +359,41 @@ MCHistoryTools::init() {
   // for (size_t i=0;i<theGenZ.size();i++) cout<<theGenZ[i]->mother()->pdgId()<<", ";
   // cout<<endl<<endl;
   
-  //AT Isolation
-  for (unsigned int j=0; j<theSortedGenLepts.size(); ++j) {
-    float iso = 0; //AT Supporting varibale to sum the different components in the isolation (ISO) variable
-    std::vector<int> id;
-    std::vector<float> pt;
+  //AT Isolation: pt sum of the stable particles (neutrinos, leptons and FSR photons excluded) within DR<0.3.
+  // The candidate particles are selected in one pass and indexed in an eta-phi grid, so that each lepton
+  // only looks at the neighbouring cells.
+  if (!theSortedGenLepts.empty()) {
+    std::vector<const reco::Candidate *> fsr(theGenFSR);
+    std::sort(fsr.begin(), fsr.end());
+    std::vector<const reco::Candidate *> isoCands;
     for( View<Candidate>::const_iterator p_iso = particles->begin(); p_iso != particles->end(); ++ p_iso) {
-      if(theSortedGenLepts[j] != &*p_iso){ //The lepton for which I am calculating the isolation is not included in the isolation itself
-        // cout << "Work in progress: isolation" << endl; //AT Uncomment just to check if the you actually enter in the loop
-        if(p_iso->status() != 1) continue; //Stable particles only (To check!)
-        if((abs(p_iso->pdgId()) == 12) || (abs(p_iso->pdgId()) == 14) || (abs(p_iso->pdgId()) == 16)) continue; //Exclude neutrinos
-        if((abs(p_iso->pdgId()) == 11) || (abs(p_iso->pdgId()) == 13)) continue; //Exclude leptons
-        if(std::find(theGenFSR.begin(), theGenFSR.end(), &*p_iso) != theGenFSR.end()) continue; //Exclude FSR photons
-        // if(std::find(theSortedGenLepts.begin(), theSortedGenLepts.end(), &*p_iso) != theSortedGenLepts.end()) continue; //Exclude prompt leptons
-        float dR = deltaR(*theSortedGenLepts[j], *p_iso);
-        if(dR < 0.3){ //AT Isolation cut for DR<0.3
-          iso += p_iso->pt();
-          id.push_back(p_iso->pdgId());
-          pt.push_back(p_iso->pt());
-        }
+      if(p_iso->status() != 1) continue; //Stable particles only (To check!)
+      int id = abs(p_iso->pdgId());
+      if(id == 12 || id == 14 || id == 16) continue; //Exclude neutrinos
+      if(id == 11 || id == 13) continue; //Exclude leptons
+      if(std::binary_search(fsr.begin(), fsr.end(), &*p_iso)) continue; //Exclude FSR photons
+      isoCands.push_back(&*p_iso);
+    }
+    EtaPhiGrid grid(1.1*0.3); // margin for the float rounding of dR
+    grid.build(isoCands.size(),
+               [&](size_t i) { return isoCands[i]->eta(); },
+               [&](size_t i) { return isoCands[i]->phi(); });
+
+    std::vector<unsigned> near;
+    for (unsigned int j=0; j<theSortedGenLepts.size(); ++j) {
+      const reco::Candidate* lep = theSortedGenLepts[j];
+      near.clear();
+      grid.forEachNear(lep->eta(), lep->phi(), [&near](unsigned i) { near.push_back(i); });
+      std::sort(near.begin(), near.end()); // sum in collection order, as in a loop over all particles
+      float iso = 0; //AT Supporting varibale to sum the different components in the isolation (ISO) variable
+      for (unsigned i : near) {
+        if(isoCands[i] == lep) continue; //The lepton for which I am calculating the isolation is not included in the isolation itself
+        float dR = deltaR(*lep, *isoCands[i]);
+        if(dR < 0.3) iso += isoCands[i]->pt(); //AT Isolation cut for DR<0.3
       }
+      iso = iso / lep->pt();
+      isolation.push_back(iso);
     }
-    iso = iso / theSortedGenLepts[j]->pt();
-    isolation.push_back(iso);
   }
   // cout<<"ATjets"<<endl;
   for(View<reco::GenJet>::const_iterator genjet = jets->begin(); genjet != jets->end(); genjet++){
@@ -8,65 +8,98 @@
 #include "FWCore/MessageLogger/interface/MessageLogger.h"
 #include "FWCore/ParameterSet/interface/FileInPath.h"
 
+#include <TMath.h>
+#include <memory>
 
-float PileUpWeight::weight(float input, PileUpWeight::PUvar var) {
 
-  if (h_nominal != nullptr && var == PUvar::NOMINAL) {
-    return h_nominal->GetBinContent(h_nominal->FindBin(input));
-  } else if (h_down != nullptr && var == PUvar::VARDOWN) {
-    return h_down->GetBinContent(h_down->FindBin(input));
-  } else if (h_up != nullptr && var == PUvar::VARUP) {
-    return h_up->GetBinContent(h_up->FindBin(input));
-  } else {
-    return -1.;
+namespace {
+  // Weight files for each PileUpWeight::Era.
+  // No dedicated preVFP profile is available yet: 2016APV uses the full 2016 one.
+  const char* puWeightFiles[] = {
+    "HTauTauHMuMu/AnalysisStep/data/PileUpWeights/pileup_UL_2016.root", // UL2016APV
+    "HTauTauHMuMu/AnalysisStep/data/PileUpWeights/pileup_UL_2016.root", // UL2016
+    "HTauTauHMuMu/AnalysisStep/data/PileUpWeights/pileup_UL_2017.root", // UL2017
+    "HTauTauHMuMu/AnalysisStep/data/PileUpWeights/pileup_UL_2018.root", // UL2018
+  };
+}
+
+
+PileUpWeight::PileUpWeight(Era era) :
+  nBins_(0), xMin_(0.), xMax_(0.)
+{
+  init(era);
+}
+
+
+PileUpWeight::PileUpWeight(int MC, int target, bool preVFP) :
+  nBins_(0), xMin_(0.), xMax_(0.)
+{
+  if (MC==target && (target==2016 || target==2017 || target==2018)) {
+    Era era = Era::UL2018;
+    if (target==2016) era = preVFP ? Era::UL2016APV : Era::UL2016;
+    else if (target==2017) era = Era::UL2017;
+    init(era);
+  }
+
+  if(w_[int(PUvar::NOMINAL)].empty()) {
+    edm::LogError("PU reweight") << "Did not find reweighting histogram to reweight MC=" << MC << " to data=" << target;
+  }
+}
+
+
+void PileUpWeight::init(Era era) {
+  edm::FileInPath fip(puWeightFiles[int(era)]);
+
+  std::unique_ptr<TFile> fPUWeight(TFile::Open(fip.fullPath().data(),"READ"));
+
+  fill((TH1*)fPUWeight->Get("weights"), PUvar::NOMINAL);
+  fill((TH1*)fPUWeight->Get("weights_varUp"), PUvar::VARUP);
+  fill((TH1*)fPUWeight->Get("weights_varDn"), PUvar::VARDOWN);
+
+  fPUWeight->Close();
+}
+
+
+void PileUpWeight::fill(const TH1* h, PUvar var) {
+  if (h == nullptr) return;
+
+  const TAxis* axis = h->GetXaxis();
+  if (w_[int(PUvar::NOMINAL)].empty()) { // binning is taken from the first histogram
+    nBins_ = axis->GetNbins();
+    xMin_ = axis->GetXmin();
+    xMax_ = axis->GetXmax();
+    if (axis->GetXbins()->GetSize() > 0) edges_.assign(axis->GetXbins()->GetArray(), axis->GetXbins()->GetArray()+nBins_+1);
+  } else if (axis->GetNbins() != nBins_) {
+    edm::LogError("PU reweight") << "Inconsistent binning for PU weight variation " << int(var);
+    return;
   }
+
+  std::vector<float>& w = w_[int(var)];
+  w.resize(nBins_+2);
+  for (int i=0; i<nBins_+2; ++i) w[i] = h->GetBinContent(i);
+}
+
+
+int PileUpWeight::findBin(float input) const {
+  if (input < xMin_) return 0;
+  if (!(input < xMax_)) return nBins_+1;
+  if (edges_.empty()) return 1 + int(nBins_*(input-xMin_)/(xMax_-xMin_));
+  return 1 + TMath::BinarySearch(nBins_+1, edges_.data(), double(input));
+}
+
+
+PileUpWeight::Weights PileUpWeight::weights(float nTrueInt) const {
+  int bin = findBin(nTrueInt);
+  Weights result;
+  result.nominal = w_[int(PUvar::NOMINAL)].empty() ? -1. : w_[int(PUvar::NOMINAL)][bin];
+  result.up      = w_[int(PUvar::VARUP)].empty()   ? -1. : w_[int(PUvar::VARUP)][bin];
+  result.down    = w_[int(PUvar::VARDOWN)].empty() ? -1. : w_[int(PUvar::VARDOWN)][bin];
+  return result;
 }
 
 
-PileUpWeight::PileUpWeight(int MC, int target) { 
-
- if (MC==2016 && target==2016)
- {
-    edm::FileInPath fip("HTauTauHMuMu/AnalysisStep/data/PileUpWeights/pileup_UL_2016.root");
-
-    TFile *fPUWeight = TFile::Open(fip.fullPath().data(),"READ");
-
-    h_nominal.reset((TH1*)fPUWeight->Get("weights")->Clone());
-    h_up.reset((TH1*)fPUWeight->Get("weights_varUp")->Clone());
-    h_down.reset((TH1*)fPUWeight->Get("weights_varDn")->Clone());
-
-    fPUWeight->Close();
-
- }
-
-	
- else if (MC==2017 && target==2017)
- {
-		edm::FileInPath fip("HTauTauHMuMu/AnalysisStep/data/PileUpWeights/pileup_UL_2017.root");
-		
-		TFile *fPUWeight = TFile::Open(fip.fullPath().data(),"READ");
-		
-		h_nominal.reset((TH1*)fPUWeight->Get("weights")->Clone());
-		h_up.reset((TH1*)fPUWeight->Get("weights_varUp")->Clone());
-		h_down.reset((TH1*)fPUWeight->Get("weights_varDn")->Clone());
-		
-		fPUWeight->Close();
- }
-	
- else if (MC==2018 && target==2018)
- {
-		edm::FileInPath fip("HTauTauHMuMu/AnalysisStep/data/PileUpWeights/pileup_UL_2018.root");
-	 
-		TFile *fPUWeight = TFile::Open(fip.fullPath().data(),"READ");
-	 
-		h_nominal.reset((TH1*)fPUWeight->Get("weights")->Clone());
-		h_up.reset((TH1*)fPUWeight->Get("weights_varUp")->Clone());
-		h_down.reset((TH1*)fPUWeight->Get("weights_varDn")->Clone());
-	 
-		fPUWeight->Close();
- }
- 
- if(h_nominal == nullptr) {
-     edm::LogError("PU reweight") << "Did not find reweighting histogram to reweight MC=" << MC << " to data=" << target;
- }
+float PileUpWeight::weight(float input, PileUpWeight::PUvar var) const {
+  const std::vector<float>& w = w_[int(var)];
+  if (w.empty()) return -1.;
+  return w[findBin(input)];
 }
@@ -0,0 +1,103 @@
+#include "HTauTauHMuMu/AnalysisStep/interface/SplineTable.h"
+#include "FWCore/Utilities/interface/Exception.h"
+
+#include <TSpline.h>
+#include <TGraphErrors.h>
+
+#include <algorithm>
+
+
+void interpolation::KnotIndex::build(const std::vector<double>& knots, unsigned cellsPerKnot) {
+  first_.clear();
+  if (knots.size() < 2) return;
+
+  unsigned nCells = cellsPerKnot*(knots.size()-1);
+  double range = knots.back()-knots.front();
+  xMin_ = knots.front();
+  invStep_ = nCells/range;
+  first_.resize(nCells);
+  for (unsigned i=0; i<nCells; ++i) {
+    double edge = xMin_ + range*i/nCells;
+    int k = int(std::lower_bound(knots.begin(), knots.end(), edge)-knots.begin()) - 1;
+    first_[i] = std::max(k, 0);
+  }
+}
+
+
+int interpolation::KnotIndex::below(const std::vector<double>& knots, double x) const {
+  const int n = knots.size();
+  if (!(x > knots.front())) return -1;
+  if (x > knots.back()) return n-1;
+
+  int cell = std::min(int((x-xMin_)*invStep_), int(first_.size())-1);
+  int k = first_[cell];
+  // The cell edge may be off by rounding; walk to the right interval
+  while (k > 0 && !(knots[k] < x)) --k;
+  while (k+1 < n && knots[k+1] < x) ++k;
+  return k;
+}
+
+
+SplineTable::SplineTable(const TSpline3* sp, unsigned cellsPerKnot) {
+  int np = sp->GetNp();
+  if (np < 2) throw cms::Exception("SplineTable") << "Spline " << sp->GetName() << " has fewer than 2 knots";
+
+  x_.resize(np); y_.resize(np); b_.resize(np); c_.resize(np); d_.resize(np);
+  for (int i=0; i<np; ++i) sp->GetCoeff(i, x_[i], y_[i], b_[i], c_[i], d_[i]);
+  index_.build(x_, cellsPerKnot);
+}
+
+
+// Knot used by TSpline3::FindX: first knot below the range, last knot above it
+int SplineTable::findKnot(double x) const {
+  if (!(x > x_.front())) return 0;
+  if (!(x < x_.back())) return x_.size()-1;
+  return index_.below(x_, x);
+}
+
+
+double SplineTable::eval(double x) const {
+  int k = findKnot(x);
+  double dx = x-x_[k];
+  return y_[k]+dx*(b_[k]+dx*(c_[k]+dx*d_[k]));
+}
+
+
+double SplineTable::evalExtrapolated(double x) const {
+  if (x < x_.front()) return y_.front() + b_.front()*(x-x_.front());
+  if (x > x_.back()) return y_.back() + b_.back()*(x-x_.back());
+  return eval(x);
+}
+
+
+GraphTable::GraphTable(const TGraphErrors* gr, unsigned cellsPerPoint) {
+  int n = gr->GetN();
+  if (n < 2) throw cms::Exception("GraphTable") << "Graph " << gr->GetName() << " has fewer than 2 points";
+
+  x_.assign(gr->GetX(), gr->GetX()+n);
+  y_.assign(gr->GetY(), gr->GetY()+n);
+  ey_.assign(gr->GetEY(), gr->GetEY()+n);
+  for (int i=1; i<n; ++i) {
+    if (!(x_[i-1] < x_[i])) throw cms::Exception("GraphTable") << "Graph " << gr->GetName() << " is not sorted in x";
+  }
+  index_.build(x_, cellsPerPoint);
+}
+
+
+double GraphTable::eval(double x) const {
+  const int n = x_.size();
+  int k = index_.below(x_, x);
+  if (k+1 < n && x_[k+1] == x) return y_[k+1];
+
+  int low = k, up = k+1;
+  if (k < 0) { low = 0; up = 1; }
+  else if (k == n-1) { low = n-2; up = n-1; }
+  return y_[up] + (x-x_[up])*(y_[low]-y_[up])/(x_[low]-x_[up]);
+}
+
+
+double GraphTable::errorY(double x) const {
+  int k = index_.below(x_, x);
+  if (k >= 0 && k+1 < int(x_.size()) && x < x_[k+1]) return ey_[k];
+  return ey_[0];
+}
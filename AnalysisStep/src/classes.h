@@ -1,6 +1,11 @@
 #include <DataFormats/PatCandidates/interface/PFParticle.h>
 #include <DataFormats/PatCandidates/interface/UserData.h>
+#include <DataFormats/Common/interface/Wrapper.h>
+#include <HTauTauHMuMu/AnalysisStep/interface/JetShifts.h>
+#include <HTauTauHMuMu/AnalysisStep/interface/GenSummary.h>
 #include <vector>
 
 edm::Ptr<pat::PFParticle> dummy1;
 pat::UserHolder<std::vector<edm::Ptr<pat::PFParticle> > > dummy2;
+pat::UserHolder<JetShifts> dummy3;
+edm::Wrapper<GenSummary> dummy4;
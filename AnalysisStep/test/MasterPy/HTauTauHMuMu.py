@@ -56,6 +56,12 @@ declareDefault("ADDLOOSEELE", False, globals())
 # Activate trigger paths in MC; note that for 2016, only reHLT samples have the correct triggers!!!
 declareDefault("APPLYTRIG", True, globals())
 
+# Skip the lepton/candidate building for events that fail the trigger or the lepton multiplicity (see PreSkimFilter)
+declareDefault("APPLYPRESKIM", False, globals())
+
+# Number of threads (and streams) for cmsRun
+declareDefault("NUMBER_OF_THREADS", 1, globals())
+
 # Set to True to re-activate the now-deprecated PATMuonCleanerBySegments
 UseMuonCleanerBySegments = False 
 
@@ -115,7 +121,10 @@ process.load("FWCore.MessageService.MessageLogger_cfi")
 process.load("Configuration.StandardSequences.GeometryDB_cff")
 process.load("Configuration.StandardSequences.MagneticField_38T_cff")
 process.load("TrackingTools.TransientTrack.TransientTrackBuilder_cfi")
-process.options = cms.untracked.PSet( wantSummary = cms.untracked.bool(True) )
+process.options = cms.untracked.PSet( wantSummary = cms.untracked.bool(True),
+                                      numberOfThreads = cms.untracked.uint32(NUMBER_OF_THREADS),
+                                      numberOfStreams = cms.untracked.uint32(0) # as many as threads
+                                      )
 
 
 ### ----------------------------------------------------------------------
@@ -620,6 +629,7 @@ if YEAR == 2018:
 process.softTaus = cms.EDProducer("TauFiller",
    src = cms.InputTag("bareTaus"),
    genCollection = cms.InputTag("prunedGenParticles"),
+   genSummary = cms.InputTag("genSummary"),
    vtxCollection = cms.InputTag("goodPrimaryVertices"),
    cut = cms.string(TAUCUT),
    discriminator = cms.string("byIsolationMVA3oldDMwoLTraw"),
@@ -640,6 +650,15 @@ process.softTaus = cms.EDProducer("TauFiller",
 
 process.taus=cms.Sequence(process.bareTaus + process.softTaus)
 
+# MC truth summary, shared by the tau gen matching and the ntuplizers
+if IsMC:
+    process.genSummary = cms.EDProducer("GenSummaryProducer",
+                                        genParticles = cms.InputTag("prunedGenParticles"),
+                                        genInfo = cms.InputTag("generator"),
+                                        genJets = cms.InputTag("slimmedGenJets"),
+                                        packedGenParticles = cms.InputTag("packedGenParticles"),
+                                        sampleName = cms.string(SAMPLENAME))
+
 
 ### ----------------------------------------------------------------------
 ### L1 Prefiring issue for 2016 and 2017 data
@@ -740,8 +759,9 @@ process.METSequence = cms.Sequence()
 PFMetName = "slimmedMETs"
 uncorrPFMetTag = cms.InputTag(PFMetName)
 
-    # Shift met due to central corrections of TES, EES, JER and JES
-process.ShiftMETcentral = cms.EDProducer ("ShiftMETcentral",
+    # Shift met due to central corrections of taus and jets, plus the JES, JER, TES, EES (E->tau ES)
+    # and MES (Mu->tau ES) variations, all in one collection (layout in interface/METShifts.h)
+process.ShiftMET = cms.EDProducer ("ShiftMET",
 					srcMET = uncorrPFMetTag,
 					tauUncorrected = cms.InputTag("bareTaus"),
 					tauCorrected = cms.InputTag("softTaus"),
@@ -749,63 +769,29 @@ process.ShiftMETcentral = cms.EDProducer ("ShiftMETcentral",
 					)
 
 srcMETTag = None
-srcMETTag = cms.InputTag("ShiftMETcentral")
+srcMETTag = cms.InputTag("ShiftMET")
 
 process.METSignificance = cms.EDProducer ("ExtractMETSignificance", 
 					srcMET=uncorrPFMetTag 
 					)
 
-    # add variables with MET shifted for TES corrections
-process.ShiftMETforTES = cms.EDProducer ("ShiftMETforTES", 
-					srcMET  = srcMETTag, 
-					tauCollection = cms.InputTag("softTaus")
-					)
-
-    # add variables with MET shifted for EES corrections (E->tau ES)
-process.ShiftMETforEES = cms.EDProducer ("ShiftMETforEES",
-					srcMET  = srcMETTag,
-					tauCollection = cms.InputTag("softTaus")
-					)
-
-    # add variables with MET shifted for MES corrections (Mu->tau ES)
-process.ShiftMETforMES = cms.EDProducer ("ShiftMETforMES",
-					srcMET  = srcMETTag,
-					tauCollection = cms.InputTag("softTaus")
-					)
-
-    # add variables with MET shifted for JES corrections
-process.ShiftMETforJES = cms.EDProducer ("ShiftMETforJES", 
-					srcMET  = srcMETTag, 
-					jetCollection = cms.InputTag("dressedJets")
-					)
-
-    # add variables with MET shifted for EES corrections (E->tau ES)
-process.ShiftMETforJER = cms.EDProducer ("ShiftMETforJER",
-					srcMET  = srcMETTag,
-					jetCollection = cms.InputTag("dressedJets")
-					)
-
     # Get a standalone Puppi MET significance collection
 #process.PuppiMETSignificance = cms.EDProducer ("ExtractMETSignificance",
 #					srcMET=cms.InputTag("slimmedMETsPuppi")
 #					)
 
     # Shift PUPPI met due to central corrections of TES and EES
-#process.ShiftPuppiMETcentral = cms.EDProducer ("ShiftMETcentral",
+#process.ShiftPuppiMET = cms.EDProducer ("ShiftMET",
 #					srcMET = cms.InputTag("slimmedMETsPuppi"),
 #					tauUncorrected = cms.InputTag("bareTaus"),
-#					tauCorrected = cms.InputTag("softTaus")
+#					tauCorrected = cms.InputTag("softTaus"),
+#					jetCollection = cms.InputTag("dressedJets")
 #					)
 
 process.METSequence += process.METSignificance
-process.METSequence += process.ShiftMETcentral
-# process.METSequence += process.ShiftMETforTES
-# process.METSequence += process.ShiftMETforEES
-# process.METSequence += process.ShiftMETforMES
-process.METSequence += process.ShiftMETforJES
-# process.METSequence += process.ShiftMETforJER
+process.METSequence += process.ShiftMET
 #process.METSequence += process.PuppiMETSignificance
-#process.METSequence += process.ShiftPuppiMETcentral
+#process.METSequence += process.ShiftPuppiMET
 metTag=uncorrPFMetTag
 
 process.load('RecoMET.METFilters.ecalBadCalibFilter_cfi')
@@ -1510,6 +1496,37 @@ else:
 ### ----------------------------------------------------------------------
 ### Create filter for events with one candidate in the SR
 
+# Pre-skim: an event passes if any channel does (one of its triggers, if any, and the lepton multiplicities).
+# Cuts are on the slimmed collections, before corrections, and must stay looser than the lepton selection.
+PRESKIM_TRIGGERS = cms.vstring()
+if APPLYTRIG:
+    for hltFilter in (process.hltFilterSingleMu, process.hltFilterSingleEle, process.hltFilterDiMu, process.hltFilterDiTau,
+                      process.hltFilterMuTau, process.hltFilterEleTau, process.hltFilterMuEle):
+        PRESKIM_TRIGGERS.extend(hltFilter.HLTPaths)
+
+PreSkimChannel = cms.PSet(triggers   = PRESKIM_TRIGGERS,
+                          nMuons     = cms.uint32(0),
+                          nElectrons = cms.uint32(0),
+                          nTaus      = cms.uint32(0))
+
+process.preSkimFilter = cms.EDFilter("PreSkimFilter",
+    triggerResults = cms.InputTag("TriggerResults","","HLT"),
+    muons = cms.InputTag("slimmedMuons"),
+    electrons = cms.InputTag("slimmedElectrons"),
+    taus = cms.InputTag("slimmedTaus"),
+    muonPtMin = cms.double(8.),     # softMuons: pt>10 after the muon scale correction
+    electronPtMin = cms.double(5.), # softElectrons: pt>7 after scale and smearing
+    tauPtMin = cms.double(30.),     # bareTaus: TAUCUT, applied before the TES
+    channels = cms.VPSet(
+        PreSkimChannel.clone(nMuons = 2),                  # mumu
+        PreSkimChannel.clone(nElectrons = 2),              # ee
+        PreSkimChannel.clone(nTaus = 2),                   # tautau
+        PreSkimChannel.clone(nMuons = 1, nElectrons = 1),  # emu
+        PreSkimChannel.clone(nMuons = 1, nTaus = 1),       # mutau
+        PreSkimChannel.clone(nElectrons = 1, nTaus = 1),   # etau
+        ),
+    )
+
 # Prepare lepton collections
 process.Candidates = cms.Path(
        process.muons             +
@@ -1523,6 +1540,14 @@ process.Candidates = cms.Path(
        process.bareZCand         + process.ZCand
     )
 
+if APPLYPRESKIM:
+    process.Candidates.insert(0, process.preSkimFilter)
+    process.Jets.insert(0, process.preSkimFilter)
+
+# The MC truth is needed for the counters also for events rejected by the pre-skim
+if IsMC:
+    process.Candidates.insert(0, process.genSummary)
+
 # Optional sequence to build control regions. To get it, add
 #process.CRPath = cms.Path(process.CRZl) # only trilepton
 #OR
@@ -46,7 +46,9 @@
 #include <HTauTauHMuMu/AnalysisStep/interface/DaughterDataHelpers.h>
 #include <HTauTauHMuMu/AnalysisStep/interface/FinalStates.h>
 #include <HTauTauHMuMu/AnalysisStep/interface/MCHistoryTools.h>
+#include <HTauTauHMuMu/AnalysisStep/interface/GenSummary.h>
 #include <HTauTauHMuMu/AnalysisStep/interface/PileUpWeight.h>
+#include <HTauTauHMuMu/AnalysisStep/interface/SplineTable.h>
 #include "SimDataFormats/HTXS/interface/HiggsTemplateCrossSections.h"
 
 //ATjets Additional libraries for GenJet variables
@@ -66,6 +68,8 @@
 #include <HTauTauHMuMu/AnalysisStep/interface/miscenums.h>
 #include <HTauTauHMuMu/AnalysisStep/interface/ggF_qcd_uncertainty_2017.h>
 #include <HTauTauHMuMu/AnalysisStep/interface/LeptonSFHelper.h>
+#include <HTauTauHMuMu/AnalysisStep/interface/METShifts.h>
+#include <HTauTauHMuMu/AnalysisStep/interface/UserFloatKeys.h>
 #include <HTauTauHMuMu/AnalysisStep/interface/SVfit.h>
 
 #include <TauPOG/TauIDSFs/interface/TauIDSFTool.h>
@@ -101,6 +105,10 @@ namespace {
   bool skipEleDataMCWeight = false; // skip computation of data/MC weight for ele
   bool skipTauDataMCWeight = false;
 
+  // Lepton energy-scale variations, stored as userFloats <name>_up and <name>_dn
+  const std::vector<std::string> eleScaleNames = {"scale_stat","scale_syst","scale_gain","sigma_rho","sigma_phi"};
+  const std::vector<std::string> muScaleNames = {"scale_total","sigma_total"};
+
   //List of variables with default values
   Int_t RunNumber  = 0;
   Long64_t EventNumber  = 0;
@@ -579,7 +587,7 @@ public:
 
   static void fillDescriptions(edm::ConfigurationDescriptions& descriptions);
 
-  static float EvalSpline(TSpline3* const& sp, float xval);
+  static void EvalKFactors(const SplineTable* tables, unsigned nVar, float xval, Float_t* const* kfactors);
 
   static void addweight(float &weight, float weighttoadd);
 
@@ -607,7 +615,6 @@ private:
   
   Float_t getAllWeight(const vector<const reco::Candidate*>& leptons);
   // Float_t getHqTWeight(double mH, double genPt) const;
-  Int_t FindBinValue(TGraphErrors *tgraph, double value);
 
   void getCheckedUserFloat(const pat::CompositeCandidate& cand, const std::string& strval, Float_t& setval, Float_t defaultval=0);
 	
@@ -628,6 +635,7 @@ private:
   bool applySkim;       //   "     "      "         skim (if skipEmptyEvents=true)
   bool skipEmptyEvents; // Skip events whith no selected candidate (otherwise, gen info is preserved for all events; candidates not passing trigger&&skim are flagged with negative ZZsel)
   FailedTreeLevel failedTreeLevel;  //if/how events with no selected candidate are written to a separate tree (see miscenums.h for details)
+  bool preSkim;         // Candidates are not built for events rejected by the PreSkimFilter (requires skipEmptyEvents and no failed tree)
   edm::InputTag metTag;
   bool applyTrigger;    // Keep only events passing trigger (overriden if skipEmptyEvents=False)
   bool applyTrigEffWeight;// apply trigger efficiency weight (concerns samples where trigger is not applied)
@@ -652,12 +660,12 @@ private:
     
   edm::EDGetTokenT<reco::GenParticleCollection> genParticleToken_bbf;//ATbbf
   edm::Handle<reco::GenParticleCollection> genParticles_bbf;//ATbbf
-  edm::Handle<edm::View<pat::PackedGenParticle> > packedgenParticles; //ATbbf
   edm::Handle<edm::View<reco::GenJet> > genJets; //ATjets
   edm::EDGetTokenT<edm::View<reco::GenJet> > genJetsToken; //ATjets
-  edm::EDGetTokenT<edm::View<pat::PackedGenParticle> > packedgenParticlesToken; //ATbbf
     
   edm::EDGetTokenT<GenEventInfoProduct> genInfoToken;
+  edm::EDGetTokenT<GenSummary> genSummaryToken;
+  edm::Handle<GenSummary> genSummary;
   edm::EDGetTokenT<edm::View<pat::CompositeCandidate> > candToken;
   edm::EDGetTokenT<edm::TriggerResults> triggerResultToken;
   edm::EDGetTokenT<edm::TriggerResults> triggerResultPATToken;
@@ -667,8 +675,6 @@ private:
   
   edm::EDGetTokenT<pat::METCollection> metToken;
   edm::EDGetTokenT<math::Error<2>::type> theCovTag;
-  edm::EDGetTokenT<pat::METCollection> metJESupToken;
-  edm::EDGetTokenT<pat::METCollection> metJESdnToken;
 //   edm::EDGetTokenT<double> theMETdxUPTESTag;
 //   edm::EDGetTokenT<double> theMETdyUPTESTag;
 //   edm::EDGetTokenT<double> theMETdxDOWNTESTag;
@@ -731,21 +737,23 @@ private:
 
   std::vector<const reco::Candidate *> genFSR;
 
-  std::vector<std::vector<float> > ewkTable;
-  TSpline3* spkfactor_ggzz_nnlo[9]; // Nominal, PDFScaleDn, PDFScaleUp, QCDScaleDn, QCDScaleUp, AsDn, AsUp, PDFReplicaDn, PDFReplicaUp
-  TSpline3* spkfactor_ggzz_nlo[9]; // Nominal, PDFScaleDn, PDFScaleUp, QCDScaleDn, QCDScaleUp, AsDn, AsUp, PDFReplicaDn, PDFReplicaUp
+  const EwkCorrections::EwkTable* ewkTable;
+  SplineTable kfactor_ggzz_nnlo[9]; // Nominal, PDFScaleDn, PDFScaleUp, QCDScaleDn, QCDScaleUp, AsDn, AsUp, PDFReplicaDn, PDFReplicaUp
+  SplineTable kfactor_ggzz_nlo[9]; // Nominal, PDFScaleDn, PDFScaleUp, QCDScaleDn, QCDScaleUp, AsDn, AsUp, PDFReplicaDn, PDFReplicaUp
 
   LeptonSFHelper *lepSFHelper;
   TauIDSFTool *DeepTauSF_VSe_ETau, *DeepTauSF_VSmu_ETau, *DeepTauSF_VSjet_ETau, *DeepTauSF_VSe_MuTau, *DeepTauSF_VSmu_MuTau, *DeepTauSF_VSjet_MuTau, *DeepTauSF_VSe_TauTau, *DeepTauSF_VSmu_TauTau, *DeepTauSF_VSjet_TauTau;
   RecoilCorrector *recoilPFMetCorrector;
   MEtSys *recoilPFMetSyst;
   std::vector<string> uncSources {};
+  // userFloat keys of the lepton energy-scale variations, in the order of eleScaleNames and muScaleNames
+  UserFloatKeys eleScaleUpKeys, eleScaleDnKeys;
+  UserFloatKeys muScaleUpKeys, muScaleDnKeys;
+  UserFloatKeys tauShiftFlagKeys;                // isTESShifted, isEESShifted
+  UserFloatKeys tauP4UpKeys[2], tauP4DnKeys[2];  // px_, py_, pz_, e_ of the TES and EES shifted p4
 
 
-  TGraphErrors *gr_NNLOPSratio_pt_powheg_0jet;
-  TGraphErrors *gr_NNLOPSratio_pt_powheg_1jet;
-  TGraphErrors *gr_NNLOPSratio_pt_powheg_2jet;
-  TGraphErrors *gr_NNLOPSratio_pt_powheg_3jet;
+  GraphTable NNLOPSratio_pt_powheg[4]; // 0, 1, 2, >=3 jets
     
   bool firstRun;
 
@@ -762,6 +770,7 @@ LLNtupleMaker::LLNtupleMaker(const edm::ParameterSet& pset) :
   myTree(nullptr),
   skipEmptyEvents(pset.getParameter<bool>("skipEmptyEvents")), // Do not store events with no selected candidate (normally: true)
   failedTreeLevel(FailedTreeLevel(pset.getParameter<int>("failedTreeLevel"))),
+  preSkim(pset.getParameter<bool>("preSkim")),
 
   metTag(pset.getParameter<edm::InputTag>("metSrc")),
   
@@ -792,8 +801,8 @@ LLNtupleMaker::LLNtupleMaker(const edm::ParameterSet& pset) :
   consumesMany<std::vector< PileupSummaryInfo > >();
   genParticleToken = consumes<edm::View<reco::Candidate> >(edm::InputTag("prunedGenParticles"));
   genParticleToken_bbf = consumes<reco::GenParticleCollection>(edm::InputTag("prunedGenParticles"));
-  packedgenParticlesToken = consumes<edm::View<pat::PackedGenParticle> > (edm::InputTag("packedGenParticles")); //ATbbf
   genInfoToken = consumes<GenEventInfoProduct>(edm::InputTag("generator"));
+  genSummaryToken = consumes<GenSummary>(edm::InputTag("genSummary"));
   genJetsToken = consumes<edm::View<reco::GenJet> >(edm::InputTag("slimmedGenJets")); //ATjets
   // GENCandidatesToken = consumes<edm::View<pat::CompositeCandidate> >(edm::InputTag("GENLevel"));
   consumesMany<LHEEventProduct>();
@@ -807,8 +816,6 @@ LLNtupleMaker::LLNtupleMaker(const edm::ParameterSet& pset) :
       
   metToken = consumes<pat::METCollection>(pset.getParameter<edm::InputTag>("metSrc"));
   theCovTag = consumes<math::Error<2>::type>(pset.getParameter<edm::InputTag>("covSrc"));
-  metJESupToken = consumes<pat::METCollection>(pset.getParameter<edm::InputTag>("metJESup"));
-  metJESdnToken = consumes<pat::METCollection>(pset.getParameter<edm::InputTag>("metJESdown"));
       
   muonToken = consumes<pat::MuonCollection>(edm::InputTag("slimmedMuons"));
   electronToken = consumes<pat::ElectronCollection>(edm::InputTag("slimmedElectrons"));
@@ -823,6 +830,10 @@ LLNtupleMaker::LLNtupleMaker(const edm::ParameterSet& pset) :
   }
   if (theChannel!=SR) failedTreeLevel=noFailedTree;
 
+  if (preSkim && (!skipEmptyEvents || failedTreeLevel)) {
+    throw cms::Exception("Configuration") << "LLNtupleMaker: the pre-skim drops events that would be stored with skipEmptyEvents=false or in the failed tree";
+  }
+
   if (applyTrigEffWeight&&applyTrigger) {
     cout << "ERROR: cannot have applyTrigEffWeight == applyTrigger == true" << endl;
   }
@@ -849,7 +860,7 @@ LLNtupleMaker::LLNtupleMaker(const edm::ParameterSet& pset) :
    
   if (isMC){
     htxsToken = consumes<HTXS::HiggsClassification>(edm::InputTag("rivetProducerHTXS","HiggsClassification"));
-    pileUpReweight = new PileUpWeight(myHelper.sampleType(), myHelper.setup());
+    pileUpReweight = new PileUpWeight(myHelper.sampleType(), myHelper.setup(), dataTag=="ULAPV");
   }
 
   Nevt_Gen = 0;
@@ -873,7 +884,7 @@ LLNtupleMaker::LLNtupleMaker(const edm::ParameterSet& pset) :
   // Read EWK K-factor table from file
   edm::FileInPath ewkFIP("HTauTauHMuMu/AnalysisStep/data/kfactors/ZZ_EwkCorrections.dat");
   fipPath=ewkFIP.fullPath();
-  ewkTable = EwkCorrections::readFile_and_loadEwkTable(fipPath.data());
+  ewkTable = &EwkCorrections::readFile_and_loadEwkTable(fipPath.data());
 
   // Read the ggZZ k-factor shape from file
   TString strZZGGKFVar[9]={
@@ -882,22 +893,20 @@ LLNtupleMaker::LLNtupleMaker(const edm::ParameterSet& pset) :
   edm::FileInPath ggzzFIP_NNLO("HTauTauHMuMu/AnalysisStep/data/kfactors/Kfactor_Collected_ggHZZ_2l2l_NNLO_NNPDF_NarrowWidth_13TeV.root");
   fipPath=ggzzFIP_NNLO.fullPath();
   TFile* ggZZKFactorFile = TFile::Open(fipPath.data());
-  for (unsigned int ikf=0; ikf<9; ikf++) spkfactor_ggzz_nnlo[ikf] = (TSpline3*)ggZZKFactorFile->Get(Form("sp_kfactor_%s", strZZGGKFVar[ikf].Data()))->Clone(Form("sp_kfactor_%s_NNLO", strZZGGKFVar[ikf].Data()));
+  for (unsigned int ikf=0; ikf<9; ikf++) kfactor_ggzz_nnlo[ikf] = SplineTable((TSpline3*)ggZZKFactorFile->Get(Form("sp_kfactor_%s", strZZGGKFVar[ikf].Data())));
   ggZZKFactorFile->Close();
   edm::FileInPath ggzzFIP_NLO("HTauTauHMuMu/AnalysisStep/data/kfactors/Kfactor_Collected_ggHZZ_2l2l_NLO_NNPDF_NarrowWidth_13TeV.root");
   fipPath=ggzzFIP_NLO.fullPath();
   ggZZKFactorFile = TFile::Open(fipPath.data());
-  for (unsigned int ikf=0; ikf<9; ikf++) spkfactor_ggzz_nlo[ikf] = (TSpline3*)ggZZKFactorFile->Get(Form("sp_kfactor_%s", strZZGGKFVar[ikf].Data()))->Clone(Form("sp_kfactor_%s_NLO", strZZGGKFVar[ikf].Data()));
+  for (unsigned int ikf=0; ikf<9; ikf++) kfactor_ggzz_nlo[ikf] = SplineTable((TSpline3*)ggZZKFactorFile->Get(Form("sp_kfactor_%s", strZZGGKFVar[ikf].Data())));
   ggZZKFactorFile->Close();
 
  
   edm::FileInPath NNLOPS_weight_path("HTauTauHMuMu/AnalysisStep/data/ggH_NNLOPS_Weights/NNLOPS_reweight.root");
   fipPath=NNLOPS_weight_path.fullPath();
   TFile* NNLOPS_weight_file = TFile::Open(fipPath.data());
-  gr_NNLOPSratio_pt_powheg_0jet = (TGraphErrors*)NNLOPS_weight_file->Get("gr_NNLOPSratio_pt_powheg_0jet");
-  gr_NNLOPSratio_pt_powheg_1jet = (TGraphErrors*)NNLOPS_weight_file->Get("gr_NNLOPSratio_pt_powheg_1jet");
-  gr_NNLOPSratio_pt_powheg_2jet = (TGraphErrors*)NNLOPS_weight_file->Get("gr_NNLOPSratio_pt_powheg_2jet");
-  gr_NNLOPSratio_pt_powheg_3jet = (TGraphErrors*)NNLOPS_weight_file->Get("gr_NNLOPSratio_pt_powheg_3jet");
+  for (unsigned int ijet=0; ijet<4; ijet++) NNLOPSratio_pt_powheg[ijet] = GraphTable((TGraphErrors*)NNLOPS_weight_file->Get(Form("gr_NNLOPSratio_pt_powheg_%djet", ijet)));
+  NNLOPS_weight_file->Close();
       
   if(dataTag=="ULAPV"){
     preVFP=true;
@@ -937,19 +946,20 @@ LLNtupleMaker::LLNtupleMaker(const edm::ParameterSet& pset) :
       recoilPFMetSyst = new MEtSys(recoilFile);
     }
 
-    uncSources.push_back("Total");
-    uncSources.push_back("Abs");
-    uncSources.push_back("Abs_year");
-    uncSources.push_back("BBEC1");
-    uncSources.push_back("BBEC1_year");
-    uncSources.push_back("EC2");
-    uncSources.push_back("EC2_year");
-    uncSources.push_back("FlavQCD");
-    uncSources.push_back("HF");
-    uncSources.push_back("HF_year");
-    uncSources.push_back("RelBal");
-    uncSources.push_back("RelSample_year");
+    // same sources and order as the MET variations
+    for (unsigned s = 0; s < JetShifts::nSources; ++s) uncSources.push_back(JetShifts::source(s));
   }
+
+  eleScaleUpKeys = UserFloatKeys("", eleScaleNames, "_up");
+  eleScaleDnKeys = UserFloatKeys("", eleScaleNames, "_dn");
+  muScaleUpKeys = UserFloatKeys("", muScaleNames, "_up");
+  muScaleDnKeys = UserFloatKeys("", muScaleNames, "_dn");
+  tauShiftFlagKeys = UserFloatKeys("is", {"TES","EES"}, "Shifted");
+  const std::vector<std::string> p4Components = {"px_","py_","pz_","e_"};
+  tauP4UpKeys[0] = UserFloatKeys("", p4Components, "TauUp");
+  tauP4DnKeys[0] = UserFloatKeys("", p4Components, "TauDown");
+  tauP4UpKeys[1] = UserFloatKeys("", p4Components, "EleUp");
+  tauP4DnKeys[1] = UserFloatKeys("", p4Components, "EleDown");
 }
 
 LLNtupleMaker::~LLNtupleMaker()
@@ -999,9 +1009,10 @@ void LLNtupleMaker::analyze(const edm::Event& event, const edm::EventSetup& eSet
     }
 
     // get PU weight
-    PUWeight = pileUpReweight->weight(NTrueInt);
-    PUWeight_Up = pileUpReweight->weight(NTrueInt, PileUpWeight::PUvar::VARUP);
-    PUWeight_Dn = pileUpReweight->weight(NTrueInt, PileUpWeight::PUvar::VARDOWN);
+    PileUpWeight::Weights puWeights = pileUpReweight->weights(NTrueInt);
+    PUWeight = puWeights.nominal;
+    PUWeight_Up = puWeights.up;
+    PUWeight_Dn = puWeights.down;
      
     // L1 prefiring weights
     // From CMSSW_10_6_26 available for all the years
@@ -1050,19 +1061,17 @@ void LLNtupleMaker::analyze(const edm::Event& event, const edm::EventSetup& eSet
     event.getByToken(genInfoToken, genInfo);
 
     event.getByToken(genJetsToken, genJets); //ATjets
-    event.getByToken(packedgenParticlesToken, packedgenParticles); //ATbbf
+    event.getByToken(genSummaryToken, genSummary);
     event.getByToken(genParticleToken_bbf, genParticles_bbf); //ATbbf
     // event.getByToken(GENCandidatesToken, GENCandidates);//ATMELA      
 
     edm::Handle<HTXS::HiggsClassification> htxs;
     event.getByToken(htxsToken,htxs);
 
-    // cout<<"begin MC history"<<endl;
-    MCHistoryTools mch(event, sampleName, genParticles, genInfo, genJets, packedgenParticles);
-    genFinalState = mch.genFinalState();
-    // cout<<"initiate"<<endl;
-    // genProcessId = mch.getProcessID();
-    genHEPMCweight = mch.gethepMCweight(); // Overridden by LHEHandler if genHEPMCweight==1.
+    // MC history, from the GenSummary made by GenSummaryProducer
+    genFinalState = genSummary->finalState;
+    // genProcessId = genSummary->processID;
+    genHEPMCweight = genSummary->hepMCweight; // Overridden by LHEHandler if genHEPMCweight==1.
     // For 2017 MC, genHEPMCweight is reweighted later from NNLO to NLO
     
     const auto& genweights = genInfo->weights();
@@ -1105,22 +1114,23 @@ void LLNtupleMaker::analyze(const edm::Event& event, const edm::EventSetup& eSet
     htxs_errorCode=htxs->errorCode;
     htxs_prodMode= htxs->prodMode;
     // cout<<"htxs"<<endl;
-    genExtInfo = mch.genAssociatedFS();
+    genExtInfo = genSummary->associatedFS;
 
     //Information on generated candidates, will be used later
-    genH = mch.genH();
-    genV = mch.genVs();
-    genLeps     = mch.sortedGenZZLeps();
-    genAssocLeps = mch.genAssociatedLeps();
-    genFSR       = mch.genFSR();
-    genVisLeps	= mch.sortedVisGenZZLeps();
-    genTauNus  	= mch.genTauNus();
+    genH = genSummary->particle(genParticles, genSummary->higgs);
+    genV = genSummary->particles(genParticles, genSummary->vs);
+    genLeps     = genSummary->particles(genParticles, genSummary->sortedLeps);
+    genAssocLeps = genSummary->particles(genParticles, genSummary->associatedLeps);
+    genFSR       = genSummary->particles(genParticles, genSummary->fsr);
+    genVisLeps	= genSummary->particles(genParticles, genSummary->visLeps);
+    genTauNus  	= genSummary->particles(genParticles, genSummary->tauNus);
         
-    genIso       = mch.genIso(); //AT
-    genJet       = mch.GenJets(); //ATjets
-    genCleanedJet= mch.GenCleanedJets(); //ATjets
-    HTAll = mch.getHTAll();
-    HTJet = mch.getHTJet();
+    genIso       = genSummary->isolation; //AT
+    genJet.clear(); //ATjets
+    for (const reco::GenJet& j : *genJets) genJet.push_back(&j);
+    genCleanedJet= genSummary->jets(genJets, genSummary->cleanedGenJets); //ATjets
+    HTAll = genSummary->HTAll;
+    HTJet = genSummary->HTJet;
 
 
     // cout<<genZ.size()<<","<<genLeps.size()<<endl;
@@ -1203,7 +1213,8 @@ void LLNtupleMaker::analyze(const edm::Event& event, const edm::EventSetup& eSet
       addweight(gen_sumGenMCWeight, genHEPMCweight);
       addweight(gen_sumWeights, PUWeight*genHEPMCweight);
 
-      mch.genAcceptance(InEtaAcceptance, InEtaPtAcceptance);
+      InEtaAcceptance = genSummary->inEtaAcceptance;
+      InEtaPtAcceptance = genSummary->inEtaPtAcceptance;
 
     addweight(Nevt_Gen_lumiBlock, 1); // Needs to be outside the if-block
 
@@ -1246,6 +1257,7 @@ void LLNtupleMaker::analyze(const edm::Event& event, const edm::EventSetup& eSet
   event.getByToken(candToken, candHandle);
   if(candHandle.failedToGet()) {
     if(is_loose_ele_selection) return; // The collection can be missing in this case since we have a filter to skip the module when a regular candidate is present.
+    else if(preSkim) return; // Event rejected by the pre-skim; it has already been counted above
     else edm::LogError("") << "LL collection not found in non-loose electron flow. This should never happen";
   }
   const edm::View<pat::CompositeCandidate>* cands = candHandle.product();
@@ -1375,24 +1387,24 @@ void LLNtupleMaker::analyze(const edm::Event& event, const edm::EventSetup& eSet
 
     if (htxsNJets==0)
     {
-      ggH_NNLOPS_weight = gr_NNLOPSratio_pt_powheg_0jet->Eval(min((double) htxsHPt, 125.0));
-      ggH_NNLOPS_weight_unc=(gr_NNLOPSratio_pt_powheg_0jet->GetErrorY(FindBinValue(gr_NNLOPSratio_pt_powheg_0jet, min((double) htxsHPt, 125.0))))/ggH_NNLOPS_weight;
+      ggH_NNLOPS_weight = NNLOPSratio_pt_powheg[0].eval(min((double) htxsHPt, 125.0));
+      ggH_NNLOPS_weight_unc=NNLOPSratio_pt_powheg[0].errorY(min((double) htxsHPt, 125.0))/ggH_NNLOPS_weight;
 
     }
 	  else if (htxsNJets==1)
 	  {
-		  ggH_NNLOPS_weight = gr_NNLOPSratio_pt_powheg_1jet->Eval(min((double)htxsHPt,625.0));
-		  ggH_NNLOPS_weight_unc=(gr_NNLOPSratio_pt_powheg_1jet->GetErrorY(FindBinValue(gr_NNLOPSratio_pt_powheg_1jet,min((double)htxsHPt,125.0))))/ggH_NNLOPS_weight;
+		  ggH_NNLOPS_weight = NNLOPSratio_pt_powheg[1].eval(min((double)htxsHPt,625.0));
+		  ggH_NNLOPS_weight_unc=NNLOPSratio_pt_powheg[1].errorY(min((double)htxsHPt,125.0))/ggH_NNLOPS_weight;
 	  }
 	  else if (htxsNJets==2)
 	  {
-		  ggH_NNLOPS_weight = gr_NNLOPSratio_pt_powheg_2jet->Eval(min((double)htxsHPt,800.0));
-		  ggH_NNLOPS_weight_unc=(gr_NNLOPSratio_pt_powheg_2jet->GetErrorY(FindBinValue(gr_NNLOPSratio_pt_powheg_2jet,min((double)htxsHPt,125.0))))/ggH_NNLOPS_weight;
+		  ggH_NNLOPS_weight = NNLOPSratio_pt_powheg[2].eval(min((double)htxsHPt,800.0));
+		  ggH_NNLOPS_weight_unc=NNLOPSratio_pt_powheg[2].errorY(min((double)htxsHPt,125.0))/ggH_NNLOPS_weight;
 	  }
 	  else if (htxsNJets>=3)
 	  {
-		  ggH_NNLOPS_weight = gr_NNLOPSratio_pt_powheg_3jet->Eval(min((double)htxsHPt,925.0));
-		  ggH_NNLOPS_weight_unc=(gr_NNLOPSratio_pt_powheg_3jet->GetErrorY(FindBinValue(gr_NNLOPSratio_pt_powheg_3jet,min((double)htxsHPt,125.0))))/ggH_NNLOPS_weight;
+		  ggH_NNLOPS_weight = NNLOPSratio_pt_powheg[3].eval(min((double)htxsHPt,925.0));
+		  ggH_NNLOPS_weight_unc=NNLOPSratio_pt_powheg[3].errorY(min((double)htxsHPt,125.0))/ggH_NNLOPS_weight;
 	  }
 	  else
 	  {
@@ -1423,18 +1435,19 @@ void LLNtupleMaker::analyze(const edm::Event& event, const edm::EventSetup& eSet
 
     // count jes up/down njets pt30
     float jes_unc = cleanedJets[i]->userFloat("jes_unc");
-    float jes_unc_Total = cleanedJets[i]->userFloat("jes_unc_split_Total");
-    float jes_unc_Abs = cleanedJets[i]->userFloat("jes_unc_split_Abs");
-    float jes_unc_Abs_year = cleanedJets[i]->userFloat("jes_unc_split_Abs_year");
-    float jes_unc_BBEC1 = cleanedJets[i]->userFloat("jes_unc_split_BBEC1");
-    float jes_unc_BBEC1_year = cleanedJets[i]->userFloat("jes_unc_split_BBEC1_year");
-    float jes_unc_EC2 = cleanedJets[i]->userFloat("jes_unc_split_EC2");
-    float jes_unc_EC2_year = cleanedJets[i]->userFloat("jes_unc_split_EC2_year");
-    float jes_unc_FlavQCD = cleanedJets[i]->userFloat("jes_unc_split_FlavQCD");
-    float jes_unc_HF = cleanedJets[i]->userFloat("jes_unc_split_HF");
-    float jes_unc_HF_year = cleanedJets[i]->userFloat("jes_unc_split_HF_year");
-    float jes_unc_RelBal = cleanedJets[i]->userFloat("jes_unc_split_RelBal");
-    float jes_unc_RelSample_year = cleanedJets[i]->userFloat("jes_unc_split_RelSample_year");
+    const JetShifts& jes = JetShifts::get(*cleanedJets[i]);
+    float jes_unc_Total = jes.unc[0];
+    float jes_unc_Abs = jes.unc[1];
+    float jes_unc_Abs_year = jes.unc[2];
+    float jes_unc_BBEC1 = jes.unc[3];
+    float jes_unc_BBEC1_year = jes.unc[4];
+    float jes_unc_EC2 = jes.unc[5];
+    float jes_unc_EC2_year = jes.unc[6];
+    float jes_unc_FlavQCD = jes.unc[7];
+    float jes_unc_HF = jes.unc[8];
+    float jes_unc_HF_year = jes.unc[9];
+    float jes_unc_RelBal = jes.unc[10];
+    float jes_unc_RelSample_year = jes.unc[11];
       
     float pt_nominal = cleanedJets[i]->pt();
     float pt_jes_up = pt_nominal * (1.0 + jes_unc);
@@ -1705,20 +1718,21 @@ void LLNtupleMaker::FillJet(const pat::Jet& jet)
      JetMult .push_back( jet.userFloat("mult"));
      JetPtD .push_back( jet.userFloat("ptD"));
    }
+   const JetShifts& jes = JetShifts::get(jet);
    if (theChannel==SR) {
     JetSigma .push_back(jet.userFloat("jes_unc"));
-    JetSigma_Total .push_back(jet.userFloat("jes_unc_split_Total"));
-    JetSigma_Abs .push_back(jet.userFloat("jes_unc_split_Abs"));
-    JetSigma_Abs_year .push_back(jet.userFloat("jes_unc_split_Abs_year"));
-    JetSigma_BBEC1 .push_back(jet.userFloat("jes_unc_split_BBEC1"));
-    JetSigma_BBEC1_year .push_back(jet.userFloat("jes_unc_split_BBEC1_year"));
-    JetSigma_EC2 .push_back(jet.userFloat("jes_unc_split_EC2"));
-    JetSigma_EC2_year .push_back(jet.userFloat("jes_unc_split_EC2_year"));
-    JetSigma_FlavQCD .push_back(jet.userFloat("jes_unc_split_FlavQCD"));
-    JetSigma_HF .push_back(jet.userFloat("jes_unc_split_HF"));
-    JetSigma_HF_year .push_back(jet.userFloat("jes_unc_split_HF_year"));
-    JetSigma_RelBal .push_back(jet.userFloat("jes_unc_split_RelBal"));
-    JetSigma_RelSample_year .push_back(jet.userFloat("jes_unc_split_RelSample_year"));
+    JetSigma_Total .push_back(jes.unc[0]);
+    JetSigma_Abs .push_back(jes.unc[1]);
+    JetSigma_Abs_year .push_back(jes.unc[2]);
+    JetSigma_BBEC1 .push_back(jes.unc[3]);
+    JetSigma_BBEC1_year .push_back(jes.unc[4]);
+    JetSigma_EC2 .push_back(jes.unc[5]);
+    JetSigma_EC2_year .push_back(jes.unc[6]);
+    JetSigma_FlavQCD .push_back(jes.unc[7]);
+    JetSigma_HF .push_back(jes.unc[8]);
+    JetSigma_HF_year .push_back(jes.unc[9]);
+    JetSigma_RelBal .push_back(jes.unc[10]);
+    JetSigma_RelSample_year .push_back(jes.unc[11]);
    }
     
    JetRawPt  .push_back( jet.userFloat("RawPt"));
@@ -1726,31 +1740,31 @@ void LLNtupleMaker::FillJet(const pat::Jet& jet)
    
    if (theChannel==SR) {
     JetJESUp .push_back(jet.userFloat("pt_jesup"));
-    JetJESUp_Total .push_back(jet.userFloat("pt_jesup_split_Total"));
-    JetJESUp_Abs .push_back(jet.userFloat("pt_jesup_split_Abs"));
-    JetJESUp_Abs_year .push_back(jet.userFloat("pt_jesup_split_Abs_year"));
-    JetJESUp_BBEC1 .push_back(jet.userFloat("pt_jesup_split_BBEC1"));
-    JetJESUp_BBEC1_year .push_back(jet.userFloat("pt_jesup_split_BBEC1_year"));
-    JetJESUp_EC2 .push_back(jet.userFloat("pt_jesup_split_EC2"));
-    JetJESUp_EC2_year .push_back(jet.userFloat("pt_jesup_split_EC2_year"));
-    JetJESUp_FlavQCD .push_back(jet.userFloat("pt_jesup_split_FlavQCD"));
-    JetJESUp_HF .push_back(jet.userFloat("pt_jesup_split_HF"));
-    JetJESUp_HF_year .push_back(jet.userFloat("pt_jesup_split_HF_year"));
-    JetJESUp_RelBal .push_back(jet.userFloat("pt_jesup_split_RelBal"));
-    JetJESUp_RelSample_year .push_back(jet.userFloat("pt_jesup_split_RelSample_year"));
+    JetJESUp_Total .push_back(jes.ptUp[0]);
+    JetJESUp_Abs .push_back(jes.ptUp[1]);
+    JetJESUp_Abs_year .push_back(jes.ptUp[2]);
+    JetJESUp_BBEC1 .push_back(jes.ptUp[3]);
+    JetJESUp_BBEC1_year .push_back(jes.ptUp[4]);
+    JetJESUp_EC2 .push_back(jes.ptUp[5]);
+    JetJESUp_EC2_year .push_back(jes.ptUp[6]);
+    JetJESUp_FlavQCD .push_back(jes.ptUp[7]);
+    JetJESUp_HF .push_back(jes.ptUp[8]);
+    JetJESUp_HF_year .push_back(jes.ptUp[9]);
+    JetJESUp_RelBal .push_back(jes.ptUp[10]);
+    JetJESUp_RelSample_year .push_back(jes.ptUp[11]);
     JetJESDown .push_back(jet.userFloat("pt_jesdn"));
-    JetJESDown_Total .push_back(jet.userFloat("pt_jesdn_split_Total"));
-    JetJESDown_Abs .push_back(jet.userFloat("pt_jesdn_split_Abs"));
-    JetJESDown_Abs_year .push_back(jet.userFloat("pt_jesdn_split_Abs_year"));
-    JetJESDown_BBEC1 .push_back(jet.userFloat("pt_jesdn_split_BBEC1"));
-    JetJESDown_BBEC1_year .push_back(jet.userFloat("pt_jesdn_split_BBEC1_year"));
-    JetJESDown_EC2 .push_back(jet.userFloat("pt_jesdn_split_EC2"));
-    JetJESDown_EC2_year .push_back(jet.userFloat("pt_jesdn_split_EC2_year"));
-    JetJESDown_FlavQCD .push_back(jet.userFloat("pt_jesdn_split_FlavQCD"));
-    JetJESDown_HF .push_back(jet.userFloat("pt_jesdn_split_HF"));
-    JetJESDown_HF_year .push_back(jet.userFloat("pt_jesdn_split_HF_year"));
-    JetJESDown_RelBal .push_back(jet.userFloat("pt_jesdn_split_RelBal"));
-    JetJESDown_RelSample_year .push_back(jet.userFloat("pt_jesdn_split_RelSample_year"));
+    JetJESDown_Total .push_back(jes.ptDn[0]);
+    JetJESDown_Abs .push_back(jes.ptDn[1]);
+    JetJESDown_Abs_year .push_back(jes.ptDn[2]);
+    JetJESDown_BBEC1 .push_back(jes.ptDn[3]);
+    JetJESDown_BBEC1_year .push_back(jes.ptDn[4]);
+    JetJESDown_EC2 .push_back(jes.ptDn[5]);
+    JetJESDown_EC2_year .push_back(jes.ptDn[6]);
+    JetJESDown_FlavQCD .push_back(jes.ptDn[7]);
+    JetJESDown_HF .push_back(jes.ptDn[8]);
+    JetJESDown_HF_year .push_back(jes.ptDn[9]);
+    JetJESDown_RelBal .push_back(jes.ptDn[10]);
+    JetJESDown_RelSample_year .push_back(jes.ptDn[11]);
 
     JetJERUp .push_back(jet.userFloat("pt_jerup"));
     JetJERDown .push_back(jet.userFloat("pt_jerdn"));
@@ -1780,22 +1794,12 @@ void LLNtupleMaker::FillPhoton(int year, const pat::Photon& photon)
    PhotonIsCutBasedLooseID .push_back( PhotonIDHelper::isCutBasedID_Loose(year, photon) );
 }
 
-float LLNtupleMaker::EvalSpline(TSpline3* const& sp, float xval){
-  double xmin = sp->GetXmin();
-  double xmax = sp->GetXmax();
-  double res=0;
-  if (xval<xmin){
-    res=sp->Eval(xmin);
-    double deriv=sp->Derivative(xmin);
-    res += deriv*(xval-xmin);
-  }
-  else if (xval>xmax){
-    res=sp->Eval(xmax);
-    double deriv=sp->Derivative(xmax);
-    res += deriv*(xval-xmax);
+// Evaluate the first nVar K-factor variations at once, extrapolating linearly outside the spline range.
+// Variations without a table are left untouched.
+void LLNtupleMaker::EvalKFactors(const SplineTable* tables, unsigned nVar, float xval, Float_t* const* kfactors){
+  for (unsigned ikf=0; ikf<nVar; ikf++){
+    if (!tables[ikf].empty()) *(kfactors[ikf]) = tables[ikf].evalExtrapolated(xval);
   }
-  else res=sp->Eval(xval);
-  return res;
 }
 
 void LLNtupleMaker::FillKFactors(edm::Handle<GenEventInfoProduct>& genInfo, std::vector<const reco::Candidate *>& genZ, std::vector<const reco::Candidate *>& genLeps){
@@ -1821,60 +1825,29 @@ void LLNtupleMaker::FillKFactors(edm::Handle<GenEventInfoProduct>& genInfo, std:
       GenHMass=(genZ.at(0)->p4()+genZ.at(1)->p4()).M();
       GenHPt=(genZ.at(0)->p4()+genZ.at(1)->p4()).Pt();
     }
+    Float_t* const kfactors[9]={
+      &KFactor_QCD_ggZZ_Nominal,
+      &KFactor_QCD_ggZZ_PDFScaleDn, &KFactor_QCD_ggZZ_PDFScaleUp,
+      &KFactor_QCD_ggZZ_QCDScaleDn, &KFactor_QCD_ggZZ_QCDScaleUp,
+      &KFactor_QCD_ggZZ_AsDn, &KFactor_QCD_ggZZ_AsUp,
+      &KFactor_QCD_ggZZ_PDFReplicaDn, &KFactor_QCD_ggZZ_PDFReplicaUp
+    };
+    // Variations are only stored in the SR
+    const unsigned nVar = (theChannel==SR ? 9 : 1);
     if (apply_K_NNLOQCD_ZZGG>0 && apply_K_NNLOQCD_ZZGG!=3){
-      if (spkfactor_ggzz_nnlo[0]!=0) KFactor_QCD_ggZZ_Nominal = LLNtupleMaker::EvalSpline(spkfactor_ggzz_nnlo[0], GenHMass);
-      if (theChannel==SR) {
-        if (spkfactor_ggzz_nnlo[1]!=0) KFactor_QCD_ggZZ_PDFScaleDn = LLNtupleMaker::EvalSpline(spkfactor_ggzz_nnlo[1], GenHMass);
-        if (spkfactor_ggzz_nnlo[2]!=0) KFactor_QCD_ggZZ_PDFScaleUp = LLNtupleMaker::EvalSpline(spkfactor_ggzz_nnlo[2], GenHMass);
-        if (spkfactor_ggzz_nnlo[3]!=0) KFactor_QCD_ggZZ_QCDScaleDn = LLNtupleMaker::EvalSpline(spkfactor_ggzz_nnlo[3], GenHMass);
-        if (spkfactor_ggzz_nnlo[4]!=0) KFactor_QCD_ggZZ_QCDScaleUp = LLNtupleMaker::EvalSpline(spkfactor_ggzz_nnlo[4], GenHMass);
-        if (spkfactor_ggzz_nnlo[5]!=0) KFactor_QCD_ggZZ_AsDn = LLNtupleMaker::EvalSpline(spkfactor_ggzz_nnlo[5], GenHMass);
-        if (spkfactor_ggzz_nnlo[6]!=0) KFactor_QCD_ggZZ_AsUp = LLNtupleMaker::EvalSpline(spkfactor_ggzz_nnlo[6], GenHMass);
-        if (spkfactor_ggzz_nnlo[7]!=0) KFactor_QCD_ggZZ_PDFReplicaDn = LLNtupleMaker::EvalSpline(spkfactor_ggzz_nnlo[7], GenHMass);
-        if (spkfactor_ggzz_nnlo[8]!=0) KFactor_QCD_ggZZ_PDFReplicaUp = LLNtupleMaker::EvalSpline(spkfactor_ggzz_nnlo[8], GenHMass);
-      }
+      LLNtupleMaker::EvalKFactors(kfactor_ggzz_nnlo, nVar, GenHMass, kfactors);
       if (apply_K_NNLOQCD_ZZGG==2){
-        if (spkfactor_ggzz_nlo[0]!=0){
-          float divisor = LLNtupleMaker::EvalSpline(spkfactor_ggzz_nlo[0], GenHMass);
-          KFactor_QCD_ggZZ_Nominal /= divisor;
-          if (theChannel==SR) {
-            KFactor_QCD_ggZZ_PDFScaleDn /= divisor;
-            KFactor_QCD_ggZZ_PDFScaleUp /= divisor;
-            KFactor_QCD_ggZZ_QCDScaleDn /= divisor;
-            KFactor_QCD_ggZZ_QCDScaleUp /= divisor;
-            KFactor_QCD_ggZZ_AsDn /= divisor;
-            KFactor_QCD_ggZZ_AsUp /= divisor;
-            KFactor_QCD_ggZZ_PDFReplicaDn /= divisor;
-            KFactor_QCD_ggZZ_PDFReplicaUp /= divisor;
-          }
+        if (!kfactor_ggzz_nlo[0].empty()){
+          float divisor = kfactor_ggzz_nlo[0].evalExtrapolated(GenHMass);
+          for (unsigned ikf=0; ikf<nVar; ikf++) *(kfactors[ikf]) /= divisor;
         }
         else{
-          KFactor_QCD_ggZZ_Nominal=0;
-          if (theChannel==SR) {
-            KFactor_QCD_ggZZ_PDFScaleDn=0;
-            KFactor_QCD_ggZZ_PDFScaleUp=0;
-            KFactor_QCD_ggZZ_QCDScaleDn=0;
-            KFactor_QCD_ggZZ_QCDScaleUp=0;
-            KFactor_QCD_ggZZ_AsDn=0;
-            KFactor_QCD_ggZZ_AsUp=0;
-            KFactor_QCD_ggZZ_PDFReplicaDn=0;
-            KFactor_QCD_ggZZ_PDFReplicaUp=0;
-          }
+          for (unsigned ikf=0; ikf<nVar; ikf++) *(kfactors[ikf]) = 0;
         }
       }
     }
     else if (apply_K_NNLOQCD_ZZGG==3){
-      if (spkfactor_ggzz_nlo[0]!=0) KFactor_QCD_ggZZ_Nominal = LLNtupleMaker::EvalSpline(spkfactor_ggzz_nlo[0], GenHMass);
-      if (theChannel==SR) {
-        if (spkfactor_ggzz_nlo[1]!=0) KFactor_QCD_ggZZ_PDFScaleDn = LLNtupleMaker::EvalSpline(spkfactor_ggzz_nlo[1], GenHMass);
-        if (spkfactor_ggzz_nlo[2]!=0) KFactor_QCD_ggZZ_PDFScaleUp = LLNtupleMaker::EvalSpline(spkfactor_ggzz_nlo[2], GenHMass);
-        if (spkfactor_ggzz_nlo[3]!=0) KFactor_QCD_ggZZ_QCDScaleDn = LLNtupleMaker::EvalSpline(spkfactor_ggzz_nlo[3], GenHMass);
-        if (spkfactor_ggzz_nlo[4]!=0) KFactor_QCD_ggZZ_QCDScaleUp = LLNtupleMaker::EvalSpline(spkfactor_ggzz_nlo[4], GenHMass);
-        if (spkfactor_ggzz_nlo[5]!=0) KFactor_QCD_ggZZ_AsDn = LLNtupleMaker::EvalSpline(spkfactor_ggzz_nlo[5], GenHMass);
-        if (spkfactor_ggzz_nlo[6]!=0) KFactor_QCD_ggZZ_AsUp = LLNtupleMaker::EvalSpline(spkfactor_ggzz_nlo[6], GenHMass);
-        if (spkfactor_ggzz_nlo[7]!=0) KFactor_QCD_ggZZ_PDFReplicaDn = LLNtupleMaker::EvalSpline(spkfactor_ggzz_nlo[7], GenHMass);
-        if (spkfactor_ggzz_nlo[8]!=0) KFactor_QCD_ggZZ_PDFReplicaUp = LLNtupleMaker::EvalSpline(spkfactor_ggzz_nlo[8], GenHMass);
-      }
+      LLNtupleMaker::EvalKFactors(kfactor_ggzz_nlo, nVar, GenHMass, kfactors);
     }
 
     if (genFinalState!=BUGGY){
@@ -1899,7 +1872,7 @@ void LLNtupleMaker::FillKFactors(edm::Handle<GenEventInfoProduct>& genInfo, std:
             GENZ2Vec.SetPtEtaPhiM(genZ.at(1)->pt(),genZ.at(1)->eta(),genZ.at(1)->phi(),genZ.at(1)->mass());
             GENZZVec = GENZ1Vec + GENZ2Vec;
           }
-          KFactor_EW_qqZZ = EwkCorrections::getEwkCorrections(genParticles, ewkTable, genInfoP, GENZ1Vec, GENZ2Vec);
+          KFactor_EW_qqZZ = EwkCorrections::getEwkCorrections(genSummary->incomingQuarkFlavour, *ewkTable, genInfoP, GENZ1Vec, GENZ2Vec);
 
           bool sameflavor=(genLeps.at(0)->pdgId()*genLeps.at(1)->pdgId() == genLeps.at(2)->pdgId()*genLeps.at(3)->pdgId());
           float K_NNLO_LO = kfactor_qqZZ_qcd_M(GenHMass, (sameflavor) ? 1 : 2, 2);
@@ -2129,13 +2102,12 @@ void LLNtupleMaker::FillCandidate(const pat::CompositeCandidate& cand, bool evtP
   //-------------------------------------------------------------------------------
 
   // Electron energy corrections
-  std::vector<std::string> correctionNames={"scale_stat","scale_syst","scale_gain","sigma_rho","sigma_phi"};
   std::vector<std::string> NPNames={"CMS_scale_e_stat_year","CMS_scale_e_syst","CMS_scale_e_gain_year","CMS_res_e_rho","CMS_res_e_rho"};
   if (theChannel==SR) {
     if (doSVFit && (abs(LLFlav)==165 || abs(LLFlav)==143)) {
       TLorentzVector tau1_up, tau1_dn;
-      for (size_t iNP=0;iNP<correctionNames.size();iNP++) {
-        tau1_up=tau1*userdatahelpers::getUserFloat(leptons[idx1],(correctionNames[iNP]+"_up").c_str());
+      for (size_t iNP=0;iNP<eleScaleNames.size();iNP++) {
+        tau1_up=tau1*userdatahelpers::getUserFloat(leptons[idx1],eleScaleUpKeys[iNP]);
         SVfit algo_up(0,tau1_up,tau2,METRecoil,covMET,pairType,dm1,dm2);
         std::vector<double> results_up=algo_up.FitAndGetResult();
         LLSVPt_up.push_back(results_up.at(0));
@@ -2143,7 +2115,7 @@ void LLNtupleMaker::FillCandidate(const pat::CompositeCandidate& cand, bool evtP
         LLSVPhi_up.push_back(results_up.at(2));
         LLSVMass_up.push_back(results_up.at(3));
         LLMass_up.push_back((LLP4-tau1+tau1_up).M());
-        tau1_dn=tau1*userdatahelpers::getUserFloat(leptons[idx1],(correctionNames[iNP]+"_dn").c_str());
+        tau1_dn=tau1*userdatahelpers::getUserFloat(leptons[idx1],eleScaleDnKeys[iNP]);
         SVfit algo_dn(0,tau1_dn,tau2,METRecoil,covMET,pairType,dm1,dm2);
         std::vector<double> results_dn=algo_dn.FitAndGetResult();
         LLSVPt_dn.push_back(results_dn.at(0));
@@ -2155,7 +2127,7 @@ void LLNtupleMaker::FillCandidate(const pat::CompositeCandidate& cand, bool evtP
       }
     }
     else {
-      for (size_t iNP=0;iNP<correctionNames.size();iNP++) {
+      for (size_t iNP=0;iNP<eleScaleNames.size();iNP++) {
         LLSVPt_up.push_back(LLSVPt);
         LLSVEta_up.push_back(LLSVEta);
         LLSVPhi_up.push_back(LLSVPhi);
@@ -2172,24 +2144,22 @@ void LLNtupleMaker::FillCandidate(const pat::CompositeCandidate& cand, bool evtP
   }
 
   // Muon energy corrections
-  correctionNames.clear();
-  correctionNames={"scale_total","sigma_total"};
   NPNames.clear();
   NPNames={"CMS_scale_m","CMS_res_m"};
   if (theChannel==SR) {
     TLorentzVector tau1_up, tau2_up, tau1_dn, tau2_dn;
-    for (size_t iNP=0;iNP<correctionNames.size();iNP++) {
+    for (size_t iNP=0;iNP<muScaleNames.size();iNP++) {
       if (abs(leptons[idx1]->pdgId())==13) {
-        tau1_up=tau1*userdatahelpers::getUserFloat(leptons[idx1],(correctionNames[iNP]+"_up").c_str());
-        tau1_dn=tau1*userdatahelpers::getUserFloat(leptons[idx1],(correctionNames[iNP]+"_dn").c_str());
+        tau1_up=tau1*userdatahelpers::getUserFloat(leptons[idx1],muScaleUpKeys[iNP]);
+        tau1_dn=tau1*userdatahelpers::getUserFloat(leptons[idx1],muScaleDnKeys[iNP]);
       }
       else {
         tau1_up=tau1;
         tau1_dn=tau1;
       }
       if (abs(leptons[idx2]->pdgId())==13) {
-        tau2_up=tau2*userdatahelpers::getUserFloat(leptons[idx2],(correctionNames[iNP]+"_up").c_str());
-        tau2_dn=tau2*userdatahelpers::getUserFloat(leptons[idx2],(correctionNames[iNP]+"_dn").c_str());
+        tau2_up=tau2*userdatahelpers::getUserFloat(leptons[idx2],muScaleUpKeys[iNP]);
+        tau2_dn=tau2*userdatahelpers::getUserFloat(leptons[idx2],muScaleDnKeys[iNP]);
       }
       else {
         tau2_up=tau2;
@@ -2225,9 +2195,7 @@ void LLNtupleMaker::FillCandidate(const pat::CompositeCandidate& cand, bool evtP
   }
 
   // Tau lepton energy corrections
-  correctionNames.clear();
-  correctionNames={"Tau","Ele","Mu"};
-  std::vector<std::string> correctionNames1={"isTESShifted","isEESShifted","isMESShifted"};
+  std::vector<std::string> correctionNames={"Tau","Ele","Mu"};
   NPNames.clear();
   NPNames={"CMS_scale_t_year","CMS_scale_efaket_year","CMS_scale_mfaket_year"};
   if (theChannel==SR) {
@@ -2235,19 +2203,19 @@ void LLNtupleMaker::FillCandidate(const pat::CompositeCandidate& cand, bool evtP
     for (size_t iNP=0;iNP<correctionNames.size();iNP++) {
       bool changed=false;
       if (iNP<correctionNames.size()-1) {
-        if (abs(leptons[idx1]->pdgId())==15 && userdatahelpers::getUserInt(leptons[idx1],correctionNames1[iNP].c_str())) {
+        if (abs(leptons[idx1]->pdgId())==15 && userdatahelpers::getUserInt(leptons[idx1],tauShiftFlagKeys[iNP])) {
           changed=true;
-          tau1_up.SetPxPyPzE(userdatahelpers::getUserFloat(leptons[idx1],("px_"+correctionNames[iNP]+"Up").c_str()),userdatahelpers::getUserFloat(leptons[idx1],("py_"+correctionNames[iNP]+"Up").c_str()),userdatahelpers::getUserFloat(leptons[idx1],("pz_"+correctionNames[iNP]+"Up").c_str()),userdatahelpers::getUserFloat(leptons[idx1],("e_"+correctionNames[iNP]+"Up").c_str()));
-          tau1_dn.SetPxPyPzE(userdatahelpers::getUserFloat(leptons[idx1],("px_"+correctionNames[iNP]+"Down").c_str()),userdatahelpers::getUserFloat(leptons[idx1],("py_"+correctionNames[iNP]+"Down").c_str()),userdatahelpers::getUserFloat(leptons[idx1],("pz_"+correctionNames[iNP]+"Down").c_str()),userdatahelpers::getUserFloat(leptons[idx1],("e_"+correctionNames[iNP]+"Down").c_str()));
+          tau1_up.SetPxPyPzE(userdatahelpers::getUserFloat(leptons[idx1],tauP4UpKeys[iNP][0]),userdatahelpers::getUserFloat(leptons[idx1],tauP4UpKeys[iNP][1]),userdatahelpers::getUserFloat(leptons[idx1],tauP4UpKeys[iNP][2]),userdatahelpers::getUserFloat(leptons[idx1],tauP4UpKeys[iNP][3]));
+          tau1_dn.SetPxPyPzE(userdatahelpers::getUserFloat(leptons[idx1],tauP4DnKeys[iNP][0]),userdatahelpers::getUserFloat(leptons[idx1],tauP4DnKeys[iNP][1]),userdatahelpers::getUserFloat(leptons[idx1],tauP4DnKeys[iNP][2]),userdatahelpers::getUserFloat(leptons[idx1],tauP4DnKeys[iNP][3]));
         }
         else {
           tau1_up=tau1;
           tau1_dn=tau1;
         }
-        if (abs(leptons[idx2]->pdgId())==15 && userdatahelpers::getUserInt(leptons[idx2],correctionNames1[iNP].c_str())) {
+        if (abs(leptons[idx2]->pdgId())==15 && userdatahelpers::getUserInt(leptons[idx2],tauShiftFlagKeys[iNP])) {
           changed=true;
-          tau2_up.SetPxPyPzE(userdatahelpers::getUserFloat(leptons[idx2],("px_"+correctionNames[iNP]+"Up").c_str()),userdatahelpers::getUserFloat(leptons[idx2],("py_"+correctionNames[iNP]+"Up").c_str()),userdatahelpers::getUserFloat(leptons[idx2],("pz_"+correctionNames[iNP]+"Up").c_str()),userdatahelpers::getUserFloat(leptons[idx2],("e_"+correctionNames[iNP]+"Up").c_str()));
-          tau2_dn.SetPxPyPzE(userdatahelpers::getUserFloat(leptons[idx2],("px_"+correctionNames[iNP]+"Down").c_str()),userdatahelpers::getUserFloat(leptons[idx2],("py_"+correctionNames[iNP]+"Down").c_str()),userdatahelpers::getUserFloat(leptons[idx2],("pz_"+correctionNames[iNP]+"Down").c_str()),userdatahelpers::getUserFloat(leptons[idx2],("e_"+correctionNames[iNP]+"Down").c_str()));
+          tau2_up.SetPxPyPzE(userdatahelpers::getUserFloat(leptons[idx2],tauP4UpKeys[iNP][0]),userdatahelpers::getUserFloat(leptons[idx2],tauP4UpKeys[iNP][1]),userdatahelpers::getUserFloat(leptons[idx2],tauP4UpKeys[iNP][2]),userdatahelpers::getUserFloat(leptons[idx2],tauP4UpKeys[iNP][3]));
+          tau2_dn.SetPxPyPzE(userdatahelpers::getUserFloat(leptons[idx2],tauP4DnKeys[iNP][0]),userdatahelpers::getUserFloat(leptons[idx2],tauP4DnKeys[iNP][1]),userdatahelpers::getUserFloat(leptons[idx2],tauP4DnKeys[iNP][2]),userdatahelpers::getUserFloat(leptons[idx2],tauP4DnKeys[iNP][3]));
         }
         else {
           tau2_up=tau2;
@@ -2309,15 +2277,14 @@ void LLNtupleMaker::FillCandidate(const pat::CompositeCandidate& cand, bool evtP
   NPNames.clear();
   NPNames=uncSources;
   
-  Handle<pat::METCollection> metJESupHandle;
-  event.getByToken(metJESupToken, metJESupHandle);
-  Handle<pat::METCollection> metJESdnHandle;
-  event.getByToken(metJESdnToken, metJESdnHandle); 
+  // JES variations of the MET, in the order of uncSources
+  Handle<pat::METCollection> metHandle;
+  event.getByToken(metToken, metHandle);
   
   if (theChannel==SR) {
     TLorentzVector MET_up, MET_dn;
     for (size_t iNP=0;iNP<correctionNames.size();iNP++) {
-      const pat::MET &met_up = metJESupHandle->at(iNP);
+      const pat::MET &met_up = metHandle->at(METShifts::index(METShifts::kJES+iNP, true));
       Float_t metx_up, mety_up;
       if (do_MET_Recoil) {
         recoilPFMetCorrector->CorrectByMeanResolution(met_up.px(),met_up.py(),GenLLPt*cos(GenLLPhi),GenLLPt*sin(GenLLPhi),GenVisLLPt*cos(GenVisLLPhi),GenVisLLPt*sin(GenVisLLPhi),nCleanedJetsPt30,metx_up,mety_up);
@@ -2328,7 +2295,7 @@ void LLNtupleMaker::FillCandidate(const pat::CompositeCandidate& cand, bool evtP
       }
       MET_up.SetPxPyPzE(metx_up,mety_up,0,std::hypot(metx_up,mety_up));
 
-      const pat::MET &met_dn = metJESdnHandle->at(iNP);
+      const pat::MET &met_dn = metHandle->at(METShifts::index(METShifts::kJES+iNP, false));
       Float_t metx_dn, mety_dn;
       if (do_MET_Recoil) {
         recoilPFMetCorrector->CorrectByMeanResolution(met_dn.px(),met_dn.py(),GenLLPt*cos(GenLLPhi),GenLLPt*sin(GenLLPhi),GenVisLLPt*cos(GenVisLLPhi),GenVisLLPt*sin(GenVisLLPhi),nCleanedJetsPt30,metx_dn,mety_dn);
@@ -3947,22 +3914,5 @@ void LLNtupleMaker::addweight(float &weight, float weighttoadd) {
 }
 
 
-Int_t LLNtupleMaker::FindBinValue(TGraphErrors *tgraph, double value)
-{
-   Double_t x_prev,x,y;
-   Int_t bin = 0;
-   x_prev = 0.;
-   for(int i=0;i<tgraph->GetN();i++){
-      tgraph->GetPoint(i,x,y);
-      if(value > x_prev && value < x){
-         bin = i;
-         break;
-      }
-      else x_prev = x;
-   }
-   if (bin == 0) bin = 1;
-   return bin-1;
-}
-
 //define this as a plug-in
 DEFINE_FWK_MODULE(LLNtupleMaker);
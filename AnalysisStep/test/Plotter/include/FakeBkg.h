@@ -26,24 +26,66 @@ class FakeBkg {
 
     protected:
 
+    // Native replacement for a fitted TF1: the shapes produced by the SuperRatio
+    // fits are evaluated directly from their parameters, anything else falls
+    // back to TF1::Eval.
+    struct CompiledTF1 {
+      enum Kind {kPoly, kPolyLandau, kPol2Linear90, kGeneric};
+      Kind kind;
+      int npar;
+      double par[8];
+      const TF1* generic;
+
+      void compile(const TF1* f);
+      double operator()(double x) const;
+    };
+
+    // TAxis::FindFixBin over a copy of the axis edges
+    struct FlatAxis {
+      int nbins;
+      bool fixed;
+      double xmin, xmax;
+      vector<double> edges;
+
+      void compile(const TAxis* axis);
+      int findBin(double x) const;
+    };
+
+    // Bin contents including under/overflow, indexed like TH1::GetBin
+    struct FlatTH1 {
+      FlatAxis x;
+      vector<float> content;
+
+      void compile(const TH1* h);
+      float value(double xv) const { return content[x.findBin(xv)]; }
+    };
+
+    struct FlatTH2 {
+      FlatAxis x, y;
+      vector<float> content;
+
+      void compile(const TH2* h);
+      float value(double xv, double yv) const { return content[x.findBin(xv)+(x.nbins+2)*y.findBin(yv)]; }
+    };
+
     TFile *f_LTau_FR, *f_LTau_Closure_FR, *f_LTau_QCDvsSR_FR, *f_LTau_WJvsSR, *f_LTau_Frac;
-    const TF1 *LTau_f_FR[3/*#fakeBkg*/][2/*#finalState*/][3/*#njetBin*/];
-    TH1F *LTau_hClosure_FR[3/*#fakeBkg*/][2/*#finalState*/][3/*#ntauptBin*/];
-    const TF1 *LTau_fClosure_FR[3/*#fakeBkg*/][2/*#finalState*/][3/*#ntauptBin*/];
-    const TF1 *LTau_fQCDvsSR_FR[2/*#finalState*/];
-    const TF1 *LTau_fWJvsSR_FR[2/*#finalState*/];
-    TH1F *LTau_hFrac_FR[3/*#fakeBkg*/][2/*#finalState*/][5/*#category*/];
+    CompiledTF1 LTau_f_FR[3/*#fakeBkg*/][2/*#finalState*/][3/*#njetBin*/];
+    float LTau_hClosure_FR[3/*#fakeBkg*/][2/*#finalState*/][3/*#ntauptBin*/];
+    CompiledTF1 LTau_fClosure_FR[3/*#fakeBkg*/][2/*#finalState*/][3/*#ntauptBin*/];
+    CompiledTF1 LTau_fQCDvsSR_FR[2/*#finalState*/];
+    CompiledTF1 LTau_fWJvsSR_FR[2/*#finalState*/];
+    FlatTH1 LTau_hFrac_FR[3/*#fakeBkg*/][2/*#finalState*/][5/*#category*/];
 
     TFile *f_TauTau_FR, *f_TauTau_Closure_FR, *f_TauTau_QCDvsSR_FR;
-    const TF1 *TauTau_f_FR[3/*#njetBin*/];
-    const TF1 *TauTau_fClosure_FR;
-    const TF1 *TauTau_fQCDvsSR_FR;
+    CompiledTF1 TauTau_f_FR[3/*#njetBin*/];
+    CompiledTF1 TauTau_fClosure_FR;
+    CompiledTF1 TauTau_fQCDvsSR_FR;
 
     TFile *f_LL_FR, *f_LL_Closure_FR, *f_LL_QCDvsSR_FR, *f_LL_Frac;
-    const TF1 *LL_f_FR[2/*#fakeBkg*/];
-    TH2F *LL_hClosure_FR[2/*#fakeBkg*/];
-    TH2F *LL_hQCDvsSR_FR;
-    TH1F *LL_hFrac_FR[2/*#fakeBkg*/][5/*#category*/];
+    CompiledTF1 LL_f_FR[2/*#fakeBkg*/];
+    FlatTH2 LL_hClosure_FR[2/*#fakeBkg*/];
+    FlatTH2 LL_hQCDvsSR_FR;
+    FlatTH1 LL_hFrac_FR[2/*#fakeBkg*/][5/*#category*/];
 
     void disabled() const{
       std::cerr << std::endl << "ERROR! Method has been disabled!"<< std::endl;
@@ -55,9 +97,9 @@ class FakeBkg {
     FakeBkg(const std::string& year, const std::string& path);
     ~FakeBkg() {}
 
-    float get_LTau_FR(int fs, int cat, int njet, float lpt, float taupt, float DR, float MT, float Mvis);
-    float get_TauTau_FR(int njet, float tau1pt, float tau2pt, float Mvis);
-    float get_LL_FR(int cat, float DR, float l1pt, float l2pt, float Mvis);
+    float get_LTau_FR(int fs, int cat, int njet, float lpt, float taupt, float DR, float MT, float Mvis) const;
+    float get_TauTau_FR(int njet, float tau1pt, float tau2pt, float Mvis) const;
+    float get_LL_FR(int cat, float DR, float l1pt, float l2pt, float Mvis) const;
 
     private:
     vector<string>  _s_final_state, _s_categories, _s_fake_bkg;
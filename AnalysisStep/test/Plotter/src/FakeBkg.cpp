@@ -2,6 +2,9 @@
 #include <iostream> // std::cerr, std::endl
 #include <iomanip> 
 #include <assert.h> // assert
+#include <algorithm>
+#include <cmath>
+#include <TMath.h>
 
 TFile* ensureTFile(const TString filename, bool verbose=false){
   if(verbose)
@@ -41,6 +44,83 @@ const TF1* extractTF1(const TFile* file, const std::string& funcname){
   return function;
 }
 
+void FakeBkg::CompiledTF1::compile(const TF1* f){
+  generic=f;
+  npar=f->GetNpar();
+  kind=kGeneric;
+  if(npar>8) return;
+  for(int i=0;i<npar;i++) par[i]=f->GetParameter(i);
+
+  TString formula=f->GetTitle();
+  formula.ReplaceAll(" ","");
+  TString degree=formula.BeginsWith("pol") ? formula(3,formula.Length()-3) : TString("");
+  if(degree.Length()>0 && degree.IsDigit() && degree.Atoi()+1==npar) kind=kPoly;
+  else if(formula=="[0]+x*[1]+[2]*TMath::Landau(x,[3],[4])" && npar==5) kind=kPolyLandau;
+  else if(formula=="([0]+[1]*x+[2]*x*x)*(x<90)+([3]*x+[0]+8100*[2]+90*[1]-90*[3])*(x>=90)" && npar==4) kind=kPol2Linear90;
+  if(kind==kGeneric) return;
+
+  // Cross-check the native shape against the TF1 over its fit range
+  double xmin, xmax;
+  f->GetRange(xmin,xmax);
+  for(int i=0;i<=20;i++){
+    double x=xmin+(xmax-xmin)*i/20.;
+    double ref=f->Eval(x);
+    if(std::abs((*this)(x)-ref)>1e-9*std::max(1.,std::abs(ref))){
+      std::cerr << "WARNING: native evaluation of '" << f->GetName() << "' disagrees with TF1::Eval, using TF1" << std::endl;
+      kind=kGeneric;
+      return;
+    }
+  }
+}
+
+double FakeBkg::CompiledTF1::operator()(double x) const{
+  switch(kind){
+    case kPoly: {
+      double r=par[npar-1];
+      for(int i=npar-2;i>=0;i--) r=r*x+par[i];
+      return r;
+    }
+    case kPolyLandau:
+      return par[0]+x*par[1]+par[2]*TMath::Landau(x,par[3],par[4]);
+    case kPol2Linear90:
+      if(x<90) return par[0]+par[1]*x+par[2]*x*x;
+      return par[3]*x+par[0]+8100*par[2]+90*par[1]-90*par[3];
+    default:
+      return generic->Eval(x);
+  }
+}
+
+void FakeBkg::FlatAxis::compile(const TAxis* axis){
+  nbins=axis->GetNbins();
+  xmin=axis->GetXmin();
+  xmax=axis->GetXmax();
+  fixed=(axis->GetXbins()->GetSize()==0);
+  edges.resize(nbins+1);
+  for(int i=0;i<=nbins;i++) edges[i]=axis->GetBinLowEdge(i+1);
+}
+
+int FakeBkg::FlatAxis::findBin(double x) const{
+  if(x<xmin) return 0;
+  if(!(x<xmax)) return nbins+1;
+  if(fixed) return 1+int(nbins*(x-xmin)/(xmax-xmin));
+  return int(std::upper_bound(edges.begin(),edges.end(),x)-edges.begin());
+}
+
+void FakeBkg::FlatTH1::compile(const TH1* h){
+  x.compile(h->GetXaxis());
+  content.resize(x.nbins+2);
+  for(int i=0;i<x.nbins+2;i++) content[i]=h->GetBinContent(i);
+}
+
+void FakeBkg::FlatTH2::compile(const TH2* h){
+  x.compile(h->GetXaxis());
+  y.compile(h->GetYaxis());
+  content.resize((x.nbins+2)*(y.nbins+2));
+  for(int iy=0;iy<y.nbins+2;iy++)
+    for(int ix=0;ix<x.nbins+2;ix++)
+      content[ix+(x.nbins+2)*iy]=h->GetBinContent(ix,iy);
+}
+
 FakeBkg::FakeBkg(const std::string& year, const std::string& path) {
 
     bool verbose = false;
@@ -66,7 +146,7 @@ FakeBkg::FakeBkg(const std::string& year, const std::string& path) {
         for (int i_fs=0;i_fs<2;i_fs++) {
             for (int i_njet=0;i_njet<3;i_njet++) {
                 _histo_name="f_FR_"+_s_fake_bkg.at(i_bkg)+"_"+_s_final_state.at(i_fs)+"_Njet"+std::to_string(i_njet);
-                LTau_f_FR[i_bkg][i_fs][i_njet]=extractTF1(f_LTau_FR,_histo_name);
+                LTau_f_FR[i_bkg][i_fs][i_njet].compile(extractTF1(f_LTau_FR,_histo_name));
             }
         }
     }
@@ -76,9 +156,9 @@ FakeBkg::FakeBkg(const std::string& year, const std::string& path) {
         for (int i_fs=0;i_fs<2;i_fs++) {
             for (int i_taupt=0;i_taupt<3;i_taupt++) {
                 _histo_name="hClosure_FR_"+_s_fake_bkg.at(i_bkg)+"_"+_s_final_state.at(i_fs)+"_Ntaupt"+std::to_string(i_taupt);
-                LTau_hClosure_FR[i_bkg][i_fs][i_taupt]=extractTH1(f_LTau_Closure_FR,_histo_name);
+                LTau_hClosure_FR[i_bkg][i_fs][i_taupt]=extractTH1(f_LTau_Closure_FR,_histo_name)->GetBinContent(1);
                 _histo_name="fClosure_FR_"+_s_fake_bkg.at(i_bkg)+"_"+_s_final_state.at(i_fs)+"_Ntaupt"+std::to_string(i_taupt);
-                LTau_fClosure_FR[i_bkg][i_fs][i_taupt]=extractTF1(f_LTau_Closure_FR,_histo_name);
+                LTau_fClosure_FR[i_bkg][i_fs][i_taupt].compile(extractTF1(f_LTau_Closure_FR,_histo_name));
             }
         }
     }
@@ -86,13 +166,13 @@ FakeBkg::FakeBkg(const std::string& year, const std::string& path) {
     f_LTau_QCDvsSR_FR=ensureTFile(path+"LTau.Step3_QCD_vsSR.root");
     for (int i_fs=0;i_fs<2;i_fs++) {
         _histo_name="fQCDvsSR_FR_"+_s_final_state.at(i_fs);
-        LTau_fQCDvsSR_FR[i_fs]=extractTF1(f_LTau_QCDvsSR_FR,_histo_name);
+        LTau_fQCDvsSR_FR[i_fs].compile(extractTF1(f_LTau_QCDvsSR_FR,_histo_name));
     }
 
     f_LTau_WJvsSR=ensureTFile(path+"LTau.Step3_WJ_vsSR.root");
     for (int i_fs=0;i_fs<2;i_fs++) {
         _histo_name="fWJvsSR_FR_"+_s_final_state.at(i_fs);
-        LTau_fWJvsSR_FR[i_fs]=extractTF1(f_LTau_WJvsSR,_histo_name);
+        LTau_fWJvsSR_FR[i_fs].compile(extractTF1(f_LTau_WJvsSR,_histo_name));
     }
 
     f_LTau_Frac=ensureTFile(path+"LTau.Step4_Fraction.root");
@@ -100,7 +180,7 @@ FakeBkg::FakeBkg(const std::string& year, const std::string& path) {
         for (int i_fs=0;i_fs<2;i_fs++) {
             for (int i_cat=0;i_cat<5;i_cat++) {
                 _histo_name="hFrac_FR_"+_s_fake_bkg.at(i_bkg)+"_"+_s_final_state.at(i_fs)+"_"+_s_categories.at(i_cat);
-                LTau_hFrac_FR[i_bkg][i_fs][i_cat]=extractTH1(f_LTau_Frac,_histo_name);
+                LTau_hFrac_FR[i_bkg][i_fs][i_cat].compile(extractTH1(f_LTau_Frac,_histo_name));
             }
         }
     }
@@ -108,44 +188,44 @@ FakeBkg::FakeBkg(const std::string& year, const std::string& path) {
     f_TauTau_FR=ensureTFile(path+"TauTau.Step1_FakeRate.root");
     for (int i_njet=0;i_njet<3;i_njet++) {
         _histo_name="f_FR_"+_s_fake_bkg.at(0)+"_"+_s_final_state.at(2)+"_Njet"+std::to_string(i_njet);
-        TauTau_f_FR[i_njet]=extractTF1(f_TauTau_FR,_histo_name);
+        TauTau_f_FR[i_njet].compile(extractTF1(f_TauTau_FR,_histo_name));
     }
 
     f_TauTau_Closure_FR=ensureTFile(path+"TauTau.Step2_Closure.root");
     _histo_name="fClosure_FR_"+_s_fake_bkg.at(0)+"_"+_s_final_state.at(2);
-    TauTau_fClosure_FR=extractTF1(f_TauTau_Closure_FR,_histo_name);
+    TauTau_fClosure_FR.compile(extractTF1(f_TauTau_Closure_FR,_histo_name));
 
     f_TauTau_QCDvsSR_FR=ensureTFile(path+"TauTau.Step3_QCD_vsSR.root");
     _histo_name="fQCDvsSR_FR_"+_s_final_state.at(2);
-    TauTau_fQCDvsSR_FR=extractTF1(f_TauTau_QCDvsSR_FR,_histo_name);
+    TauTau_fQCDvsSR_FR.compile(extractTF1(f_TauTau_QCDvsSR_FR,_histo_name));
 
     f_LL_FR=ensureTFile(path+"LL.Step1_FakeRate.root");
     for (int i_bkg=0;i_bkg<2;i_bkg++) {
         _histo_name="f_FR_"+_s_fake_bkg.at(i_bkg==0?0:2)+"_"+_s_final_state.at(3);
-        LL_f_FR[i_bkg]=extractTF1(f_LL_FR,_histo_name);
+        LL_f_FR[i_bkg].compile(extractTF1(f_LL_FR,_histo_name));
     }
 
     f_LL_Closure_FR=ensureTFile(path+"LL.Step2_Closure.root");
     for (int i_bkg=0;i_bkg<2;i_bkg++) {
         _histo_name="hClosure_FR_"+_s_fake_bkg.at(i_bkg==0?0:2)+"_"+_s_final_state.at(3);
-        LL_hClosure_FR[i_bkg]=extractTH2(f_LL_Closure_FR,_histo_name);
+        LL_hClosure_FR[i_bkg].compile(extractTH2(f_LL_Closure_FR,_histo_name));
     }
 
     f_LL_QCDvsSR_FR=ensureTFile(path+"LL.Step3_QCD_vsSR.root");
     _histo_name="hQCDvsSR_FR_"+_s_final_state.at(3);
-    LL_hQCDvsSR_FR=extractTH2(f_LL_QCDvsSR_FR,_histo_name);
+    LL_hQCDvsSR_FR.compile(extractTH2(f_LL_QCDvsSR_FR,_histo_name));
 
     f_LL_Frac=ensureTFile(path+"LL.Step4_Fraction.root");
     for (int i_bkg=0;i_bkg<2;i_bkg++) {
         for (int i_cat=0;i_cat<5;i_cat++) {
             _histo_name="hFrac_FR_"+_s_fake_bkg.at(i_bkg==0?0:2)+"_"+_s_final_state.at(3)+"_"+_s_categories.at(i_cat);
-            LL_hFrac_FR[i_bkg][i_cat]=extractTH1(f_LL_Frac,_histo_name);
+            LL_hFrac_FR[i_bkg][i_cat].compile(extractTH1(f_LL_Frac,_histo_name));
         }
     }
 
 }
 
-float FakeBkg::get_LTau_FR(int fs, int cat, int njet, float lpt, float taupt, float DR, float MT, float Mvis)
+float FakeBkg::get_LTau_FR(int fs, int cat, int njet, float lpt, float taupt, float DR, float MT, float Mvis) const
 {
     int taupt_bin;
     if (taupt<=40) taupt_bin=0;
@@ -160,18 +240,18 @@ float FakeBkg::get_LTau_FR(int fs, int cat, int njet, float lpt, float taupt, fl
 
     float FR[3],CL[3],vsSR[3],frac[3];
     for (int i_bkg=0;i_bkg<3;i_bkg++) {
-        FR[i_bkg]=LTau_f_FR[i_bkg][fs][njet]->Eval(taupt);
-        if (lpt<=23 && LTau_hClosure_FR[i_bkg][fs][taupt_bin]->GetBinContent(1)>0) {
-            CL[i_bkg]=LTau_hClosure_FR[i_bkg][fs][taupt_bin]->GetBinContent(1);
+        FR[i_bkg]=LTau_f_FR[i_bkg][fs][njet](taupt);
+        if (lpt<=23 && LTau_hClosure_FR[i_bkg][fs][taupt_bin]>0) {
+            CL[i_bkg]=LTau_hClosure_FR[i_bkg][fs][taupt_bin];
         }
         else {
-            CL[i_bkg]=LTau_fClosure_FR[i_bkg][fs][taupt_bin]->Eval(lpt);
+            CL[i_bkg]=LTau_fClosure_FR[i_bkg][fs][taupt_bin](lpt);
         }
-        frac[i_bkg]=LTau_hFrac_FR[i_bkg][fs][cat]->GetBinContent(LTau_hFrac_FR[i_bkg][fs][cat]->FindBin(Mvis));
+        frac[i_bkg]=LTau_hFrac_FR[i_bkg][fs][cat].value(Mvis);
     }
 
-    vsSR[0]=LTau_fQCDvsSR_FR[fs]->Eval(DR);
-    vsSR[1]=LTau_fWJvsSR_FR[fs]->Eval(MT);
+    vsSR[0]=LTau_fQCDvsSR_FR[fs](DR);
+    vsSR[1]=LTau_fWJvsSR_FR[fs](MT);
     vsSR[2]=1.;
 
     float tot=0;
@@ -181,20 +261,21 @@ float FakeBkg::get_LTau_FR(int fs, int cat, int njet, float lpt, float taupt, fl
     return tot;
 }
 
-float FakeBkg::get_TauTau_FR(int njet, float tau1pt, float tau2pt, float Mvis)
+float FakeBkg::get_TauTau_FR(int njet, float tau1pt, float tau2pt, float Mvis) const
 {
     if (tau2pt>150) tau2pt=150;
     if (tau1pt>150) tau1pt=150;
     if (Mvis<20) Mvis=21;
     if (Mvis>300) Mvis=299;
 
-    float FR=TauTau_f_FR[njet]->Eval(tau2pt);
-    float CL=TauTau_fClosure_FR->Eval(tau1pt);
-    float vsSR=TauTau_fQCDvsSR_FR->Eval(Mvis);
+    float FR=TauTau_f_FR[njet](tau2pt);
+    float CL=TauTau_fClosure_FR(tau1pt);
+    float vsSR=TauTau_fQCDvsSR_FR(Mvis);
     float tot=FR/(1.-FR)*CL*vsSR;
     return tot;
 }
-float FakeBkg::get_LL_FR(int cat, float DR, float l1pt, float l2pt, float Mvis)
+
+float FakeBkg::get_LL_FR(int cat, float DR, float l1pt, float l2pt, float Mvis) const
 {
     if (l1pt>150) l1pt=150;
     if (l2pt>150) l2pt=150;
@@ -204,12 +285,12 @@ float FakeBkg::get_LL_FR(int cat, float DR, float l1pt, float l2pt, float Mvis)
 
     float FR[2],CL[2],vsSR[2],frac[2];
     for (int i_bkg=0;i_bkg<2;i_bkg++) {
-        FR[i_bkg]=LL_f_FR[i_bkg]->Eval(DR);
-        CL[i_bkg]=LL_hClosure_FR[i_bkg]->GetBinContent(LL_hClosure_FR[i_bkg]->FindBin(l1pt,l2pt));
+        FR[i_bkg]=LL_f_FR[i_bkg](DR);
+        CL[i_bkg]=LL_hClosure_FR[i_bkg].value(l1pt,l2pt);
         if (CL[i_bkg]<=0) CL[i_bkg]=1.;
-        frac[i_bkg]=LL_hFrac_FR[i_bkg][cat]->GetBinContent(LL_hFrac_FR[i_bkg][cat]->FindBin(Mvis));
+        frac[i_bkg]=LL_hFrac_FR[i_bkg][cat].value(Mvis);
     }
-    vsSR[0]=LL_hQCDvsSR_FR->GetBinContent(LL_hQCDvsSR_FR->FindBin(l1pt,l2pt));
+    vsSR[0]=LL_hQCDvsSR_FR.value(l1pt,l2pt);
     if (vsSR[0]<=0) vsSR[0]=1.;
     vsSR[1]=1.;
 
@@ -218,4 +299,4 @@ float FakeBkg::get_LL_FR(int cat, float DR, float l1pt, float l2pt, float Mvis)
         tot+=FR[i_bkg]*CL[i_bkg]*vsSR[i_bkg]*frac[i_bkg];
     }
     return tot;
-}
\ No newline at end of file
+}
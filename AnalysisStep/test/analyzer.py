@@ -161,36 +161,15 @@ TreeSetup = cms.EDAnalyzer("LLNtupleMaker",
                            dataTag=cms.string(DATA_TAG), #added for recognizing UL16 pre/post VFP
                            
                            #for MET and SV fit
-                           metSrc = cms.InputTag("ShiftMETcentral"),#srcMETTag,#metTag,
+                           metSrc = cms.InputTag("ShiftMET"),#srcMETTag,#metTag,
                            covSrc = cms.InputTag("METSignificance", "METCovariance"),
-                           metJESup = cms.InputTag("ShiftMETforJES","up"),
-                           metJESdown = cms.InputTag("ShiftMETforJES","down"),
-#                            METdxUPTES = cms.InputTag("ShiftMETforTES", "METdxUP"),
-#                            METdyUPTES = cms.InputTag("ShiftMETforTES", "METdyUP"),
-#                            METdxDOWNTES = cms.InputTag("ShiftMETforTES", "METdxDOWN"),
-#                            METdyDOWNTES = cms.InputTag("ShiftMETforTES", "METdyDOWN"),
-#                            METdxUPEES = cms.InputTag("ShiftMETforEES", "METdxUPEES"),
-#                            METdyUPEES = cms.InputTag("ShiftMETforEES", "METdyUPEES"),
-#                            METdxDOWNEES = cms.InputTag("ShiftMETforEES", "METdxDOWNEES"),
-#                            METdyDOWNEES = cms.InputTag("ShiftMETforEES", "METdyDOWNEES"),
-#                            METdxUPMES = cms.InputTag("ShiftMETforMES", "METdxUPMES"),
-#                            METdyUPMES = cms.InputTag("ShiftMETforMES", "METdyUPMES"),
-#                            METdxDOWNMES = cms.InputTag("ShiftMETforMES", "METdxDOWNMES"),
-#                            METdyDOWNMES = cms.InputTag("ShiftMETforMES", "METdyDOWNMES"),
-#                            METdxUPJES = cms.InputTag("ShiftMETforJES", "METdxUPJES"),
-#                            METdyUPJES = cms.InputTag("ShiftMETforJES", "METdyUPJES"),
-#                            METdxDOWNJES = cms.InputTag("ShiftMETforJES", "METdxDOWNJES"),
-#                            METdyDOWNJES = cms.InputTag("ShiftMETforJES", "METdyDOWNJES"),
-#                            METdxUPJER = cms.InputTag("ShiftMETforJER", "METdxUPJER"),
-#                            METdyUPJER = cms.InputTag("ShiftMETforJER", "METdyUPJER"),
-#                            METdxDOWNJER = cms.InputTag("ShiftMETforJER", "METdxDOWNJER"),
-#                            METdyDOWNJER = cms.InputTag("ShiftMETforJER", "METdyDOWNJER"),
                            
                            applyTrigger = cms.bool(APPLYTRIG), #Skip events failing required triggers. They are stored with sel<0 if set to false
                            applyTrigEff = cms.bool(False), #Add trigger efficiency as a weight, for samples where the trigger cannot be applied (obsoltete)
                            doMETRecoil = cms.bool(DOMETRECOIL),
                            skipEmptyEvents = cms.bool(SKIP_EMPTY_EVENTS),
                            failedTreeLevel = cms.int32(FAILED_TREE_LEVEL),
+                           preSkim = cms.bool(APPLYPRESKIM),
                            sampleName = cms.string(SAMPLENAME),
                            GenXSEC = cms.double(GENXSEC),
                            GenBR = cms.double(GENBR),